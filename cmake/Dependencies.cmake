@@ -122,3 +122,6 @@ if(RAVEN_ENABLE_IMGUI)
         add_library(imgui::imgui ALIAS imgui)
     endif()
 endif()
+
+# ── Threads (JobSystem workers, Prefetch loader thread) ───────────
+find_package(Threads REQUIRED)
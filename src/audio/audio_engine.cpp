@@ -1,5 +1,7 @@
 #include "audio/audio_engine.hpp"
 
+#include "core/asset_pack.hpp"
+
 #include <spdlog/spdlog.h>
 
 #include <algorithm>
@@ -49,10 +51,22 @@ bool AudioEngine::load_sound(const std::string& id, const std::string& path) {
     }
 
     Sound sound;
-    if (!SDL_LoadWAV(path.c_str(), &sound.spec, &sound.data, &sound.len)) {
+    if (!decode_sound(path, sound)) {
         spdlog::warn("Failed to load sound '{}' from '{}': {}", id, path, SDL_GetError());
         return false;
     }
+    return add_sound(id, sound);
+}
+
+bool AudioEngine::decode_sound(const std::string& path, Sound& out) {
+    return SDL_LoadWAV_IO(assets::open_io(path), true, &out.spec, &out.data, &out.len);
+}
+
+bool AudioEngine::add_sound(const std::string& id, Sound sound) {
+    if (device_ == 0) {
+        SDL_free(sound.data);
+        return false;
+    }
 
     // Replace an existing sound with the same id
     if (auto it = sounds_.find(id); it != sounds_.end()) {
@@ -39,6 +39,27 @@ class AudioEngine {
     /// @return True on success.
     bool load_sound(const std::string& id, const std::string& path);
 
+    /// @brief A decoded WAV: samples owned by SDL (freed with SDL_free).
+    struct Sound {
+        SDL_AudioSpec spec{};
+        Uint8* data = nullptr;
+        Uint32 len = 0;
+    };
+
+    /// @brief Decode a WAV without touching the device; safe on any thread.
+    /// @param path Full path to the WAV file (use paths::asset()).
+    /// @param out Decoded samples; the caller owns them until add_sound().
+    /// @return True on success.
+    static bool decode_sound(const std::string& path, Sound& out);
+
+    /// @brief Register decoded samples as a named sound, taking ownership.
+    ///
+    /// Without a device the samples are freed and nothing is registered.
+    /// @param id Name used by play().
+    /// @param sound Samples from decode_sound().
+    /// @return True if the sound was registered.
+    bool add_sound(const std::string& id, Sound sound);
+
     /// @brief Play a loaded sound once.
     /// @param id The sound name passed to load_sound().
     /// @param gain Per-play volume multiplier, combined with the master gain.
@@ -60,13 +81,6 @@ class AudioEngine {
     [[nodiscard]] int active_streams() const { return static_cast<int>(streams_.size()); }
 
   private:
-    /// @brief A loaded WAV: samples owned by SDL (freed with SDL_free).
-    struct Sound {
-        SDL_AudioSpec spec{};
-        Uint8* data = nullptr;
-        Uint32 len = 0;
-    };
-
     SDL_AudioDeviceID device_ = 0;
     std::unordered_map<std::string, Sound> sounds_;
     std::vector<SDL_AudioStream*> streams_; ///< Streams currently bound and playing.
@@ -0,0 +1,385 @@
+#include "core/asset_pack.hpp"
+
+#include <SDL3_image/SDL_image.h>
+#include <spdlog/spdlog.h>
+
+#include <algorithm>
+#include <cstring>
+#include <fstream>
+
+#ifdef _WIN32
+#ifndef WIN32_LEAN_AND_MEAN
+#define WIN32_LEAN_AND_MEAN
+#endif
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace raven {
+
+// Pack layout (host byte order; the magic doubles as an endianness check):
+//
+//   Header   magic "RPAK", version, entry count, names size
+//   Index    IndexEntry[count], sorted by name
+//   Names    names size bytes, not NUL-terminated
+//   Payloads each starting at a multiple of AssetPack::ALIGNMENT
+
+namespace {
+
+constexpr char MAGIC[4] = {'R', 'P', 'A', 'K'};
+
+struct FileHeader {
+    char magic[4];
+    uint32_t version;
+    uint32_t count;
+    uint32_t names_size;
+};
+
+struct IndexEntry {
+    uint64_t offset; ///< From the start of the file.
+    uint64_t size;
+    uint32_t kind;
+    uint32_t name_offset; ///< From the start of the names block.
+    uint32_t name_len;
+    uint32_t reserved;
+};
+
+static_assert(sizeof(FileHeader) == 16 && sizeof(IndexEntry) == 32, "pack layout is fixed");
+
+size_t align_up(size_t n, size_t alignment) {
+    return (n + alignment - 1) / alignment * alignment;
+}
+
+IndexEntry index_at(const uint8_t* base, size_t i) {
+    IndexEntry e;
+    std::memcpy(&e, base + sizeof(FileHeader) + i * sizeof(IndexEntry), sizeof(e));
+    return e;
+}
+
+AssetPack& mounted() {
+    static AssetPack pack;
+    return pack;
+}
+
+} // namespace
+
+// ── AssetPack ──────────────────────────────────────────────────────
+
+AssetPack::~AssetPack() {
+    close();
+}
+
+bool AssetPack::open(const std::string& path) {
+    close();
+
+#ifdef _WIN32
+    HANDLE file = CreateFileA(path.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING,
+                              FILE_ATTRIBUTE_NORMAL, nullptr);
+    if (file == INVALID_HANDLE_VALUE) {
+        return false;
+    }
+    LARGE_INTEGER file_size;
+    HANDLE mapping = nullptr;
+    const void* view = nullptr;
+    if (GetFileSizeEx(file, &file_size) && file_size.QuadPart > 0) {
+        mapping = CreateFileMappingA(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+    }
+    if (mapping) {
+        view = MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+    }
+    if (!view) {
+        if (mapping) {
+            CloseHandle(mapping);
+        }
+        CloseHandle(file);
+        spdlog::error("Failed to map asset pack '{}'", path);
+        return false;
+    }
+    file_ = file;
+    mapping_ = mapping;
+    base_ = static_cast<const uint8_t*>(view);
+    size_ = static_cast<size_t>(file_size.QuadPart);
+#else
+    int fd = ::open(path.c_str(), O_RDONLY);
+    if (fd < 0) {
+        return false;
+    }
+    struct stat st {};
+    void* view = MAP_FAILED;
+    if (fstat(fd, &st) == 0 && st.st_size > 0) {
+        view = mmap(nullptr, static_cast<size_t>(st.st_size), PROT_READ, MAP_PRIVATE, fd, 0);
+    }
+    ::close(fd); // the mapping keeps the file alive
+    if (view == MAP_FAILED) {
+        spdlog::error("Failed to map asset pack '{}'", path);
+        return false;
+    }
+    base_ = static_cast<const uint8_t*>(view);
+    size_ = static_cast<size_t>(st.st_size);
+#endif
+
+    FileHeader header{};
+    bool ok = size_ >= sizeof(header);
+    if (ok) {
+        std::memcpy(&header, base_, sizeof(header));
+        ok = std::memcmp(header.magic, MAGIC, sizeof(MAGIC)) == 0 && header.version == VERSION;
+    }
+    size_t names_start = sizeof(FileHeader) + size_t{header.count} * sizeof(IndexEntry);
+    ok = ok && names_start + header.names_size <= size_;
+    for (size_t i = 0; ok && i < header.count; ++i) {
+        auto e = index_at(base_, i);
+        ok = e.offset <= size_ && e.size <= size_ - e.offset &&
+             size_t{e.name_offset} + e.name_len <= header.names_size;
+    }
+    if (!ok) {
+        spdlog::error("Asset pack '{}' is corrupt or from another version", path);
+        close();
+        return false;
+    }
+
+    count_ = header.count;
+    auto last_slash = path.find_last_of("/\\");
+    root_ = last_slash == std::string::npos ? std::string{} : path.substr(0, last_slash + 1);
+    spdlog::info("Mapped asset pack '{}': {} entries, {} bytes", path, count_, size_);
+    return true;
+}
+
+void AssetPack::close() {
+    if (!base_) {
+        return;
+    }
+#ifdef _WIN32
+    UnmapViewOfFile(base_);
+    CloseHandle(static_cast<HANDLE>(mapping_));
+    CloseHandle(static_cast<HANDLE>(file_));
+    file_ = nullptr;
+    mapping_ = nullptr;
+#else
+    munmap(const_cast<uint8_t*>(base_), size_);
+#endif
+    base_ = nullptr;
+    size_ = 0;
+    count_ = 0;
+    root_.clear();
+}
+
+std::string_view AssetPack::name_at(size_t i) const {
+    auto e = index_at(base_, i);
+    const auto* names = base_ + sizeof(FileHeader) + count_ * sizeof(IndexEntry);
+    return {reinterpret_cast<const char*>(names + e.name_offset), e.name_len};
+}
+
+std::optional<AssetView> AssetPack::find(std::string_view path) const {
+    if (!base_) {
+        return std::nullopt;
+    }
+    if (!root_.empty() && path.substr(0, root_.size()) == root_) {
+        path.remove_prefix(root_.size());
+    }
+
+    size_t lo = 0;
+    size_t hi = count_;
+    while (lo < hi) {
+        size_t mid = lo + (hi - lo) / 2;
+        if (name_at(mid) < path) {
+            lo = mid + 1;
+        } else {
+            hi = mid;
+        }
+    }
+    if (lo == count_ || name_at(lo) != path) {
+        return std::nullopt;
+    }
+    auto e = index_at(base_, lo);
+    return AssetView{static_cast<AssetKind>(e.kind), base_ + e.offset, static_cast<size_t>(e.size)};
+}
+
+// ── AssetPackWriter ────────────────────────────────────────────────
+
+void AssetPackWriter::add_raw(const std::string& name, const void* data, size_t size) {
+    const auto* bytes = static_cast<const uint8_t*>(data);
+    entries_.push_back({name, AssetKind::Raw, {bytes, bytes + size}});
+}
+
+void AssetPackWriter::add_json(const std::string& name, const nlohmann::json& j) {
+    entries_.push_back({name, AssetKind::Json, nlohmann::json::to_msgpack(j)});
+}
+
+bool AssetPackWriter::add_pixels(const std::string& name, SDL_Surface* surface) {
+    SDL_Surface* rgba = SDL_ConvertSurface(surface, SDL_PIXELFORMAT_RGBA32);
+    if (!rgba) {
+        spdlog::error("Failed to convert '{}' to RGBA32: {}", name, SDL_GetError());
+        return false;
+    }
+
+    PixelsHeader header{};
+    header.w = static_cast<uint32_t>(rgba->w);
+    header.h = static_cast<uint32_t>(rgba->h);
+    header.pitch = static_cast<uint32_t>(rgba->w) * 4;
+    header.format = SDL_PIXELFORMAT_RGBA32;
+    header.data_offset = static_cast<uint32_t>(AssetPack::ALIGNMENT);
+
+    std::vector<uint8_t> bytes(header.data_offset + size_t{header.pitch} * header.h);
+    std::memcpy(bytes.data(), &header, sizeof(header));
+    const auto* src = static_cast<const uint8_t*>(rgba->pixels);
+    for (size_t y = 0; y < header.h; ++y) {
+        std::memcpy(bytes.data() + header.data_offset + size_t{header.pitch} * y,
+                    src + static_cast<size_t>(rgba->pitch) * y, header.pitch);
+    }
+    SDL_DestroySurface(rgba);
+
+    entries_.push_back({name, AssetKind::Pixels, std::move(bytes)});
+    return true;
+}
+
+bool AssetPackWriter::write(const std::string& path) const {
+    // Sort by name; of several entries with the same name, keep the last added
+    std::vector<const Entry*> sorted;
+    sorted.reserve(entries_.size());
+    for (const auto& e : entries_) {
+        sorted.push_back(&e);
+    }
+    std::stable_sort(sorted.begin(), sorted.end(),
+                     [](const Entry* a, const Entry* b) { return a->name < b->name; });
+    std::vector<const Entry*> unique;
+    for (size_t i = 0; i < sorted.size(); ++i) {
+        if (i + 1 < sorted.size() && sorted[i + 1]->name == sorted[i]->name) {
+            continue;
+        }
+        unique.push_back(sorted[i]);
+    }
+
+    std::vector<IndexEntry> index(unique.size());
+    std::string names;
+    for (size_t i = 0; i < unique.size(); ++i) {
+        index[i].name_offset = static_cast<uint32_t>(names.size());
+        index[i].name_len = static_cast<uint32_t>(unique[i]->name.size());
+        names += unique[i]->name;
+    }
+
+    size_t offset = sizeof(FileHeader) + index.size() * sizeof(IndexEntry) + names.size();
+    for (size_t i = 0; i < unique.size(); ++i) {
+        offset = align_up(offset, AssetPack::ALIGNMENT);
+        index[i].offset = offset;
+        index[i].size = unique[i]->bytes.size();
+        index[i].kind = static_cast<uint32_t>(unique[i]->kind);
+        offset += unique[i]->bytes.size();
+    }
+
+    std::vector<uint8_t> out(offset, 0);
+    FileHeader header{};
+    std::memcpy(header.magic, MAGIC, sizeof(MAGIC));
+    header.version = AssetPack::VERSION;
+    header.count = static_cast<uint32_t>(index.size());
+    header.names_size = static_cast<uint32_t>(names.size());
+    std::memcpy(out.data(), &header, sizeof(header));
+    std::memcpy(out.data() + sizeof(header), index.data(), index.size() * sizeof(IndexEntry));
+    std::memcpy(out.data() + sizeof(header) + index.size() * sizeof(IndexEntry), names.data(),
+                names.size());
+    for (size_t i = 0; i < unique.size(); ++i) {
+        std::memcpy(out.data() + index[i].offset, unique[i]->bytes.data(),
+                    unique[i]->bytes.size());
+    }
+
+    if (!SDL_SaveFile(path.c_str(), out.data(), out.size())) {
+        spdlog::error("Failed to write asset pack '{}': {}", path, SDL_GetError());
+        return false;
+    }
+    return true;
+}
+
+// ── assets ─────────────────────────────────────────────────────────
+
+namespace assets {
+
+bool mount(const std::string& pack_path) {
+    if (!mounted().open(pack_path)) {
+        spdlog::info("No asset pack at '{}' — reading loose files", pack_path);
+        return false;
+    }
+    return true;
+}
+
+void unmount() {
+    mounted().close();
+}
+
+const AssetPack& pack() {
+    return mounted();
+}
+
+SDL_Surface* load_surface(const std::string& path) {
+    auto view = mounted().find(path);
+    if (!view) {
+        return IMG_Load(path.c_str());
+    }
+    if (view->kind != AssetKind::Pixels) {
+        return IMG_Load_IO(SDL_IOFromConstMem(view->data, view->size), true);
+    }
+
+    PixelsHeader header{};
+    if (view->size < sizeof(header)) {
+        SDL_SetError("Truncated pixels entry");
+        return nullptr;
+    }
+    std::memcpy(&header, view->data, sizeof(header));
+    if (header.data_offset > view->size ||
+        size_t{header.pitch} * header.h > view->size - header.data_offset) {
+        SDL_SetError("Truncated pixels entry");
+        return nullptr;
+    }
+    // SDL only reads a borrowed buffer when creating textures from it
+    return SDL_CreateSurfaceFrom(static_cast<int>(header.w), static_cast<int>(header.h),
+                                 static_cast<SDL_PixelFormat>(header.format),
+                                 const_cast<uint8_t*>(view->data + header.data_offset),
+                                 static_cast<int>(header.pitch));
+}
+
+bool load_json(const std::string& path, nlohmann::json& out) {
+    if (auto view = mounted().find(path)) {
+        if (view->kind == AssetKind::Json) {
+            out = nlohmann::json::from_msgpack(view->data, view->data + view->size);
+        } else {
+            out = nlohmann::json::parse(view->data, view->data + view->size);
+        }
+        return true;
+    }
+
+    std::ifstream f(path);
+    if (!f.is_open()) {
+        return false;
+    }
+    out = nlohmann::json::parse(f);
+    return true;
+}
+
+void* load_file(const std::string& path, size_t* size) {
+    auto view = mounted().find(path);
+    if (!view) {
+        return SDL_LoadFile(path.c_str(), size);
+    }
+    void* data = SDL_malloc(view->size);
+    if (data) {
+        std::memcpy(data, view->data, view->size);
+        *size = view->size;
+    }
+    return data;
+}
+
+SDL_IOStream* open_io(const std::string& path) {
+    if (auto view = mounted().find(path)) {
+        return SDL_IOFromConstMem(view->data, view->size);
+    }
+    return SDL_IOFromFile(path.c_str(), "rb");
+}
+
+} // namespace assets
+
+} // namespace raven
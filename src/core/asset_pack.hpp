@@ -0,0 +1,158 @@
+#pragma once
+
+#include <SDL3/SDL.h>
+#include <nlohmann/json.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace raven {
+
+/// @brief How an asset pack entry is stored.
+enum class AssetKind : uint32_t {
+    Raw = 0,    ///< File bytes as found on disk (WAV, LDtk, baked levels).
+    Pixels = 1, ///< Decoded image: PixelsHeader, then RGBA32 rows.
+    Json = 2,   ///< JSON document re-encoded as MessagePack.
+};
+
+/// @brief Prefix of a Pixels entry; the rows follow at PixelsHeader::data_offset.
+struct PixelsHeader {
+    uint32_t w;
+    uint32_t h;
+    uint32_t pitch;
+    uint32_t format;      ///< SDL_PixelFormat of the rows.
+    uint32_t data_offset; ///< Byte offset of the first row from the entry start.
+    uint32_t reserved;
+};
+
+/// @brief One entry of a mapped pack. Points into the mapping, valid while the pack is open.
+struct AssetView {
+    AssetKind kind;
+    const uint8_t* data;
+    size_t size;
+};
+
+/// @brief Read-only, memory-mapped asset archive (.rpak).
+///
+/// Layout: a header, an index sorted by name, the name strings, then the
+/// entry payloads, each aligned to ALIGNMENT bytes so decoded pixels can be
+/// handed to SDL straight from the mapping. Entry names are paths relative
+/// to the directory holding the pack ("assets/sprites/player.png"), which is
+/// also where paths::asset() resolves to, so lookups accept either form.
+class AssetPack {
+  public:
+    static constexpr uint32_t VERSION = 1;
+    static constexpr size_t ALIGNMENT = 64;
+
+    AssetPack() = default;
+    ~AssetPack();
+
+    AssetPack(const AssetPack&) = delete;
+    AssetPack& operator=(const AssetPack&) = delete;
+
+    /// @brief Map a pack file, replacing any pack already open.
+    /// @param path Path to the .rpak file.
+    /// @return False if the file is missing, truncated, or from another version.
+    bool open(const std::string& path);
+
+    /// @brief Unmap the pack. Views handed out earlier become dangling.
+    void close();
+
+    /// @brief Whether a pack is mapped.
+    [[nodiscard]] bool is_open() const { return base_ != nullptr; }
+
+    /// @brief Number of entries in the pack.
+    [[nodiscard]] size_t entry_count() const { return count_; }
+
+    /// @brief Look up an entry by name.
+    /// @param path Entry name, or that name prefixed with the pack's directory.
+    /// @return The entry, or nullopt if the pack is closed or has no such entry.
+    [[nodiscard]] std::optional<AssetView> find(std::string_view path) const;
+
+  private:
+    [[nodiscard]] std::string_view name_at(size_t i) const;
+
+    const uint8_t* base_ = nullptr;
+    size_t size_ = 0;
+    size_t count_ = 0;
+    std::string root_; ///< Directory of the pack file, ending in a separator.
+#ifdef _WIN32
+    void* file_ = nullptr;
+    void* mapping_ = nullptr;
+#endif
+};
+
+/// @brief Collects entries and writes them out as a .rpak file.
+class AssetPackWriter {
+  public:
+    /// @brief Add file bytes verbatim.
+    void add_raw(const std::string& name, const void* data, size_t size);
+
+    /// @brief Add a JSON document, stored as MessagePack.
+    void add_json(const std::string& name, const nlohmann::json& j);
+
+    /// @brief Add a decoded image, converted to RGBA32.
+    /// @return False if the conversion failed.
+    bool add_pixels(const std::string& name, SDL_Surface* surface);
+
+    /// @brief Write the collected entries; later duplicates of a name win.
+    /// @return True on success.
+    bool write(const std::string& path) const;
+
+  private:
+    struct Entry {
+        std::string name;
+        AssetKind kind;
+        std::vector<uint8_t> bytes;
+    };
+    std::vector<Entry> entries_;
+};
+
+/// @brief Asset reads that prefer the mounted pack and fall back to loose files.
+///
+/// Game mounts "raven.rpak" next to the executable at startup, if there is
+/// one. Loaders pass the same resolved paths they always have; entries
+/// missing from the pack (or every entry, when none is mounted) are read
+/// from disk, so development builds work without ever building a pack.
+/// Mount before any loads start: the functions below may run on loader
+/// threads but mount() itself is not synchronised with them.
+namespace assets {
+
+/// @brief Map @p pack_path as the global pack. A missing file is not an error.
+/// @return True if a pack is now mounted.
+bool mount(const std::string& pack_path);
+
+/// @brief Unmap the global pack; surfaces borrowed from it must already be gone.
+void unmount();
+
+/// @brief The global pack (closed when nothing is mounted).
+[[nodiscard]] const AssetPack& pack();
+
+/// @brief Load an image as a surface.
+///
+/// Packed images wrap the mapped pixels without copying; loose files go
+/// through IMG_Load. Either way the caller frees it with SDL_DestroySurface.
+/// @return The surface, or nullptr with SDL_GetError() set.
+[[nodiscard]] SDL_Surface* load_surface(const std::string& path);
+
+/// @brief Load and parse a JSON document.
+/// @param path Resolved asset path.
+/// @param out Parsed document.
+/// @return False if the file does not exist. Parse errors throw nlohmann::json::exception.
+bool load_json(const std::string& path, nlohmann::json& out);
+
+/// @brief Read raw file bytes (use load_json() for JSON, which the pack re-encodes).
+/// @return Bytes to release with SDL_free(), or nullptr with SDL_GetError() set.
+[[nodiscard]] void* load_file(const std::string& path, size_t* size);
+
+/// @brief Open a read stream over a packed entry or a loose file.
+/// @return Stream to close with SDL_CloseIO(), or nullptr with SDL_GetError() set.
+[[nodiscard]] SDL_IOStream* open_io(const std::string& path);
+
+} // namespace assets
+
+} // namespace raven
@@ -1,5 +1,6 @@
 #include "core/game.hpp"
 
+#include "core/asset_pack.hpp"
 #include "core/paths.hpp"
 #include "core/string_id.hpp"
 #include "scenes/title_scene.hpp"
@@ -8,7 +9,9 @@
 #include <nlohmann/json.hpp>
 #include <spdlog/spdlog.h>
 
-#include <fstream>
+#include <algorithm>
+#include <string>
+#include <vector>
 
 namespace raven {
 
@@ -47,6 +50,10 @@ bool Game::init() {
     debug_overlay_.init(renderer_.sdl_window(), renderer_.sdl_renderer());
 #endif
 
+    // Release builds ship a pack next to the executable; without one (or for
+    // files it lacks) every loader reads the loose assets directory
+    assets::mount(paths::asset("raven.rpak"));
+
     if (!load_assets()) {
         return false;
     }
@@ -65,48 +72,136 @@ bool Game::init() {
     return true;
 }
 
+namespace {
+
+/// @brief One startup asset: decoded on a worker, then uploaded on the main thread.
+struct PendingAsset {
+    enum class Kind { Font, Sound, Sheet };
+
+    Kind kind;
+    std::string id;   ///< Sheet/sound id; the path for the font.
+    std::string path; ///< As written in config.json.
+    int w = 0;        ///< Frame or glyph width.
+    int h = 0;        ///< Frame or glyph height.
+
+    SDL_Surface* surface = nullptr;
+    AudioEngine::Sound sound;
+    bool decoded = false;
+    double decode_ms = 0.0;
+};
+
+double elapsed_ms(Uint64 start) {
+    return static_cast<double>(SDL_GetPerformanceCounter() - start) * 1000.0 /
+           static_cast<double>(SDL_GetPerformanceFrequency());
+}
+
+} // namespace
+
 bool Game::load_assets() {
+    const Uint64 load_start = SDL_GetPerformanceCounter();
     const std::string config_path = paths::asset("assets/data/config.json");
-    std::ifstream f(config_path);
-    if (!f.is_open()) {
-        spdlog::warn("Could not open '{}' — running without assets", config_path);
-        return true;
-    }
 
+    std::vector<PendingAsset> pending;
     try {
-        auto config = nlohmann::json::parse(f);
+        nlohmann::json config;
+        if (!assets::load_json(config_path, config)) {
+            spdlog::warn("Could not open '{}' — running without assets", config_path);
+            return true;
+        }
 
         if (config.contains("font")) {
             const auto& fj = config["font"];
             auto path = fj.value("path", "assets/fonts/font.png");
-            int gw = fj.value("glyph_w", 6);
-            int gh = fj.value("glyph_h", 8);
-            if (!font_.load(renderer_.sdl_renderer(), paths::asset(path), gw, gh)) {
-                spdlog::warn("Failed to load font atlas '{}' — text will not render", path);
-            }
+            pending.push_back({PendingAsset::Kind::Font, path, path, fj.value("glyph_w", 6),
+                               fj.value("glyph_h", 8)});
         }
 
-        if (config.contains("sounds")) {
+        // Without a device there is nowhere to play sounds, so skip decoding them
+        if (config.contains("sounds") && audio_.is_ready()) {
             for (const auto& [id, path] : config["sounds"].items()) {
-                audio_.load_sound(id, paths::asset(path.get<std::string>()));
+                pending.push_back({PendingAsset::Kind::Sound, id, path.get<std::string>()});
             }
         }
 
         if (config.contains("sprite_sheets")) {
             for (const auto& sheet : config["sprite_sheets"]) {
-                auto id = sheet.at("id").get<std::string>();
-                auto path = sheet.at("path").get<std::string>();
-                int fw = sheet.at("frame_w").get<int>();
-                int fh = sheet.at("frame_h").get<int>();
-                if (!sprites_.load(renderer_.sdl_renderer(), id, paths::asset(path), fw, fh)) {
-                    spdlog::warn("Failed to load sprite sheet '{}'", id);
-                }
+                pending.push_back({PendingAsset::Kind::Sheet, sheet.at("id").get<std::string>(),
+                                   sheet.at("path").get<std::string>(),
+                                   sheet.at("frame_w").get<int>(),
+                                   sheet.at("frame_h").get<int>()});
             }
         }
     } catch (const nlohmann::json::exception& e) {
         spdlog::warn("Failed to parse config.json: {}", e.what());
     }
 
+    // Decode phase: image and WAV decoding touch no renderer or device state,
+    // so every asset decodes on its own job
+    JobFence decoded;
+    for (auto& asset : pending) {
+        jobs_.submit(decoded, [&asset] {
+            const Uint64 start = SDL_GetPerformanceCounter();
+            const std::string full_path = paths::asset(asset.path);
+            if (asset.kind == PendingAsset::Kind::Sound) {
+                asset.decoded = AudioEngine::decode_sound(full_path, asset.sound);
+            } else {
+                asset.surface = assets::load_surface(full_path);
+                asset.decoded = asset.surface != nullptr;
+            }
+            if (!asset.decoded) {
+                spdlog::warn("Failed to decode '{}': {}", full_path, SDL_GetError());
+            }
+            asset.decode_ms = elapsed_ms(start);
+        });
+    }
+    jobs_.wait(decoded);
+
+    // Upload phase: textures must be created on the renderer's thread. Images
+    // go into the shared atlas, tallest first so the skyline packs tightly;
+    // anything the atlas cannot take gets its own texture.
+    std::stable_sort(pending.begin(), pending.end(),
+                     [](const PendingAsset& a, const PendingAsset& b) {
+                         return (a.surface ? a.surface->h : 0) > (b.surface ? b.surface->h : 0);
+                     });
+    for (auto& asset : pending) {
+        const Uint64 start = SDL_GetPerformanceCounter();
+        SDL_Renderer* sdl = renderer_.sdl_renderer();
+        AtlasRegion region;
+        if (asset.surface) {
+            region = atlas_.add(sdl, asset.path, asset.surface);
+        }
+        switch (asset.kind) {
+        case PendingAsset::Kind::Font:
+            if (region.texture) {
+                font_.attach(region, asset.w, asset.h);
+            } else if (!asset.decoded || !font_.create(sdl, asset.surface, asset.w, asset.h)) {
+                spdlog::warn("Failed to load font atlas '{}' — text will not render", asset.path);
+            }
+            break;
+        case PendingAsset::Kind::Sound:
+            if (asset.decoded) {
+                audio_.add_sound(asset.id, asset.sound);
+            }
+            break;
+        case PendingAsset::Kind::Sheet:
+            if (region.texture) {
+                sprites_.add(asset.id, region, asset.w, asset.h);
+            } else if (!asset.decoded ||
+                       !sprites_.add(sdl, asset.id, asset.surface, asset.w, asset.h)) {
+                spdlog::warn("Failed to load sprite sheet '{}'", asset.id);
+            }
+            break;
+        }
+        if (asset.surface) {
+            SDL_DestroySurface(asset.surface);
+        }
+        spdlog::debug("Asset '{}': decode {:.2f} ms, upload {:.2f} ms", asset.path,
+                      asset.decode_ms, elapsed_ms(start));
+    }
+
+    spdlog::info("Loaded {} assets in {:.1f} ms ({} decode workers, {} atlas pages)",
+                 pending.size(), elapsed_ms(load_start), jobs_.worker_count(),
+                 atlas_.page_count());
     return true;
 }
 
@@ -151,25 +246,32 @@ void Game::run() {
             break;
         }
 
-        // Fixed timestep updates
+        // Fixed timestep updates. When the active scene renders from a
+        // snapshot, the ticks run on a worker while this thread renders and
+        // presents the last published one; otherwise they run inline first.
         int steps = clock_.advance(frame_delta);
-        for (int i = 0; i < steps; ++i) {
-            fixed_update(Clock::TICK_RATE);
-            // Consume press edges after the first tick so one press fires
-            // exactly one tick. Unconsumed edges (frames that run zero
-            // ticks, e.g. on >120 Hz displays) stay latched in Input.
-            input_.consume_pressed();
+        JobFence simulation;
+        if (steps > 0 && scenes_.concurrent_update()) {
+            jobs_.submit(simulation, [this, steps] { run_ticks(steps); });
+        } else {
+            run_ticks(steps);
         }
 
+        // Render
+        simulation_ = &simulation;
+        render(simulation);
+
+        // Join the simulation, then do the main-thread work it requested
+        jobs_.wait(simulation);
+        simulation_ = nullptr;
+        scenes_.sync(*this);
+
         // Reap finished sound effect streams
         audio_.update();
 
         // Pump Steam callbacks (no-op when inactive)
         steam_.run_callbacks();
 
-        // Render
-        render();
-
         // Without vsync the loop would busy-spin at uncapped speed (100%
         // CPU/GPU). Cap the frame rate instead; 240 fps keeps input latency
         // low while still bounding the spin.
@@ -188,6 +290,16 @@ void Game::run() {
     }
 }
 
+void Game::run_ticks(int steps) {
+    for (int i = 0; i < steps; ++i) {
+        fixed_update(Clock::TICK_RATE);
+        // Consume press edges after the first tick so one press fires
+        // exactly one tick. Unconsumed edges (frames that run zero
+        // ticks, e.g. on >120 Hz displays) stay latched in Input.
+        input_.consume_pressed();
+    }
+}
+
 void Game::fixed_update(float dt) {
     scenes_.update(*this, dt);
 }
@@ -211,14 +323,22 @@ void Game::apply_settings() {
     settings_.save(settings_path_);
 }
 
-void Game::render() {
+void Game::wait_for_simulation() {
+    if (simulation_) {
+        jobs_.wait(*simulation_);
+    }
+}
+
+void Game::render([[maybe_unused]] JobFence& simulation) {
     renderer_.begin_frame();
     scenes_.render(*this);
     renderer_.end_frame();
 
 #ifdef RAVEN_ENABLE_IMGUI
+    // The inspector reads the live registry, so wait for the ticks first
+    jobs_.wait(simulation);
     debug_overlay_.begin_frame();
-    debug_overlay_.render(renderer_.sdl_renderer(), registry_);
+    debug_overlay_.render(renderer_.sdl_renderer(), registry_, renderer_.frame_stats());
 #endif
 
     renderer_.present();
@@ -234,8 +354,10 @@ void Game::shutdown() {
 #endif
     sprites_ = SpriteSheetManager{}; // release all textures before renderer
     font_ = BitmapFont{};
+    atlas_.clear();
     renderer_.shutdown();
     audio_.shutdown();
+    assets::unmount(); // nothing borrows packed pixels once the scenes are gone
     steam_.shutdown();
     input_.shutdown(); // close gamepad before SDL_Quit
 
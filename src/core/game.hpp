@@ -3,12 +3,14 @@
 #include "audio/audio_engine.hpp"
 #include "core/clock.hpp"
 #include "core/input.hpp"
+#include "core/jobs.hpp"
 #include "core/save_data.hpp"
 #include "core/settings.hpp"
 #include "platform/steam.hpp"
 #include "rendering/bitmap_font.hpp"
 #include "rendering/renderer.hpp"
 #include "rendering/sprite_sheet.hpp"
+#include "rendering/texture_atlas.hpp"
 #include "scenes/scene.hpp"
 
 #ifdef RAVEN_ENABLE_IMGUI
@@ -44,10 +46,24 @@ class Game {
     /// @return Mutable reference to the Renderer.
     Renderer& renderer() { return renderer_; }
 
+    /// @brief Access the worker pool shared by the simulation systems.
+    /// @return Mutable reference to the JobSystem.
+    JobSystem& jobs() { return jobs_; }
+
+    /// @brief Block until the tick batch running alongside render() finishes.
+    ///
+    /// For main-thread work in Scene::render() that touches state the
+    /// ticks read. No-op outside render() or when the ticks ran inline.
+    void wait_for_simulation();
+
     /// @brief Access the sprite sheet manager.
     /// @return Mutable reference to the SpriteSheetManager.
     SpriteSheetManager& sprites() { return sprites_; }
 
+    /// @brief Access the texture atlas shared by sprite sheets, the font and tilesets.
+    /// @return Mutable reference to the TextureAtlas.
+    TextureAtlas& atlas() { return atlas_; }
+
     /// @brief Access the input subsystem.
     /// @return Mutable reference to the Input handler.
     Input& input() { return input_; }
@@ -103,6 +119,10 @@ class Game {
 
   private:
     bool running_ = false;
+    JobFence* simulation_ = nullptr; ///< Tick batch of the current frame, while render() runs.
+
+    // Declared first so the workers outlive every subsystem that submits jobs
+    JobSystem jobs_;
 
     // Subsystems
     Renderer renderer_;
@@ -110,6 +130,7 @@ class Game {
     Clock clock_;
     SceneManager scenes_;
     SpriteSheetManager sprites_;
+    TextureAtlas atlas_; ///< Pages are destroyed in shutdown(), before the renderer.
     Settings settings_;
     SaveData save_data_;
     BitmapFont font_;
@@ -125,12 +146,17 @@ class Game {
     // ECS
     entt::registry registry_;
 
+    /// @brief Run a frame's batch of fixed ticks, consuming input edges.
+    /// @param steps Number of ticks (from Clock::advance).
+    void run_ticks(int steps);
+
     /// @brief Execute one fixed-timestep tick of game logic.
     /// @param dt Fixed timestep delta in seconds (Clock::TICK_RATE).
     void fixed_update(float dt);
 
-    /// @brief Render the current frame via the active scene and overlay.
-    void render();
+    /// @brief Render and present the current frame via the scenes and overlay.
+    /// @param simulation Fence of the tick batch running concurrently (may be done).
+    void render(JobFence& simulation);
 
     /// @brief Load sprite sheets and other initial assets.
     /// @return True if all required assets loaded successfully.
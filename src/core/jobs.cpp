@@ -0,0 +1,180 @@
+#include "core/jobs.hpp"
+
+#include <algorithm>
+
+namespace {
+
+/// @brief Pool the current thread works for, and its queue index there.
+thread_local const raven::JobSystem* tls_pool = nullptr;
+thread_local std::size_t tls_index = 0;
+
+} // namespace
+
+namespace raven {
+
+JobSystem::JobSystem(std::size_t workers) {
+    queues_.reserve(workers + 1);
+    for (std::size_t i = 0; i < workers + 1; ++i) {
+        queues_.push_back(std::make_unique<Queue>());
+    }
+    threads_.reserve(workers);
+    for (std::size_t i = 0; i < workers; ++i) {
+        threads_.emplace_back([this, i] { worker_loop(i); });
+    }
+}
+
+JobSystem::~JobSystem() {
+    {
+        std::lock_guard lock(sleep_mutex_);
+        stop_ = true;
+    }
+    wake_.notify_all();
+    for (auto& thread : threads_) {
+        thread.join();
+    }
+}
+
+std::size_t JobSystem::default_worker_count() {
+    unsigned hw = std::thread::hardware_concurrency();
+    return hw > 2 ? hw - 1 : 1;
+}
+
+std::size_t JobSystem::home_queue() const {
+    // Workers use their own deque; everyone else shares the injection deque
+    return tls_pool == this ? tls_index : threads_.size();
+}
+
+void JobSystem::submit(JobFence& fence, Job job) {
+    fence.pending_.fetch_add(1, std::memory_order_relaxed);
+    {
+        auto& queue = *queues_[home_queue()];
+        std::lock_guard lock(queue.mutex);
+        queue.tasks.push_back({std::move(job), &fence});
+    }
+    queued_.fetch_add(1, std::memory_order_release);
+
+    // Taking the lock orders this with a worker checking queued_ before sleeping
+    { std::lock_guard lock(sleep_mutex_); }
+    wake_.notify_one();
+}
+
+bool JobSystem::try_run_one(std::size_t home) {
+    if (queued_.load(std::memory_order_acquire) == 0) {
+        return false;
+    }
+
+    Task task;
+    bool found = false;
+    {
+        auto& own = *queues_[home];
+        std::lock_guard lock(own.mutex);
+        if (!own.tasks.empty()) {
+            task = std::move(own.tasks.back());
+            own.tasks.pop_back();
+            found = true;
+        }
+    }
+
+    // Steal the oldest job from the next non-empty deque
+    for (std::size_t n = 1; !found && n < queues_.size(); ++n) {
+        auto& victim = *queues_[(home + n) % queues_.size()];
+        std::lock_guard lock(victim.mutex);
+        if (!victim.tasks.empty()) {
+            task = std::move(victim.tasks.front());
+            victim.tasks.pop_front();
+            found = true;
+        }
+    }
+
+    if (!found) {
+        return false;
+    }
+    queued_.fetch_sub(1, std::memory_order_relaxed);
+    run(task);
+    return true;
+}
+
+void JobSystem::run(Task& task) {
+    JobFence* fence = task.fence;
+    try {
+        task.job();
+    } catch (...) {
+        std::lock_guard lock(fence->error_mutex_);
+        if (!fence->error_) {
+            fence->error_ = std::current_exception();
+        }
+    }
+    task.job = nullptr;
+
+    // The waiter may destroy the fence as soon as it reads zero, so only
+    // the pool's own members are touched after the decrement
+    fence->pending_.fetch_sub(1, std::memory_order_acq_rel);
+    { std::lock_guard lock(sleep_mutex_); }
+    wake_.notify_all();
+}
+
+void JobSystem::wait(JobFence& fence) {
+    std::size_t home = home_queue();
+    while (!fence.done()) {
+        if (try_run_one(home)) {
+            continue;
+        }
+        std::unique_lock lock(sleep_mutex_);
+        wake_.wait(lock, [&] {
+            return fence.done() || queued_.load(std::memory_order_acquire) > 0;
+        });
+    }
+
+    std::lock_guard lock(fence.error_mutex_);
+    if (fence.error_) {
+        std::rethrow_exception(std::exchange(fence.error_, nullptr));
+    }
+}
+
+void JobSystem::parallel_for(std::size_t count, std::size_t grain,
+                             const std::function<void(std::size_t, std::size_t)>& fn) {
+    if (count == 0) {
+        return;
+    }
+    grain = std::max<std::size_t>(grain, 1);
+    if (threads_.empty() || count <= grain) {
+        fn(0, count);
+        return;
+    }
+
+    JobFence fence;
+    for (std::size_t begin = grain; begin < count; begin += grain) {
+        std::size_t end = std::min(begin + grain, count);
+        submit(fence, [&fn, begin, end] { fn(begin, end); });
+    }
+
+    // The queued chunks reference fn and fence, so drain them even on a throw
+    std::exception_ptr error;
+    try {
+        fn(0, grain);
+    } catch (...) {
+        error = std::current_exception();
+    }
+    wait(fence);
+    if (error) {
+        std::rethrow_exception(error);
+    }
+}
+
+void JobSystem::worker_loop(std::size_t index) {
+    tls_pool = this;
+    tls_index = index;
+
+    for (;;) {
+        if (try_run_one(index)) {
+            continue;
+        }
+        std::unique_lock lock(sleep_mutex_);
+        wake_.wait(lock, [this] { return stop_ || queued_.load(std::memory_order_acquire) > 0; });
+        if (stop_) {
+            return;
+        }
+    }
+}
+
+} // namespace raven
@@ -0,0 +1,173 @@
+#pragma once
+
+#include <entt/entt.hpp>
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <tuple>
+#include <utility>
+#include <vector>
+
+namespace raven {
+
+/// @brief Counts a batch of outstanding jobs.
+///
+/// Frame-scoped: put one on the stack, submit the batch against it, and
+/// call JobSystem::wait() before it goes out of scope. Jobs may submit more
+/// jobs against the same fence; wait() returns once all of them finished.
+class JobFence {
+  public:
+    JobFence() = default;
+    JobFence(const JobFence&) = delete;
+    JobFence& operator=(const JobFence&) = delete;
+
+    /// @brief Whether every job submitted against the fence has finished.
+    [[nodiscard]] bool done() const { return pending_.load(std::memory_order_acquire) == 0; }
+
+  private:
+    friend class JobSystem;
+
+    std::atomic<std::size_t> pending_{0}; ///< Submitted but unfinished jobs.
+    std::mutex error_mutex_;              ///< Guards error_.
+    std::exception_ptr error_;            ///< First exception thrown by a job.
+};
+
+/// @brief Work-stealing thread pool.
+///
+/// Every worker owns a deque. A worker pushes and pops its own jobs at the
+/// back (most recent first, still warm in cache) and, when it runs dry,
+/// steals from the front of the others'. Threads outside the pool submit
+/// into a shared injection deque. Threads blocked in wait() run queued
+/// jobs instead of sleeping, so nested parallel_for calls cannot deadlock.
+///
+/// Game owns the instance; GameScene publishes it in the registry ctx as a
+/// JobSystem* (see find_jobs) for systems that split their loops.
+class JobSystem {
+  public:
+    using Job = std::function<void()>;
+
+    /// @brief Start the worker threads.
+    /// @param workers Threads besides the callers; 0 runs every job in wait().
+    explicit JobSystem(std::size_t workers = default_worker_count());
+
+    /// @brief Stop and join the workers. Outstanding fences must be waited first.
+    ~JobSystem();
+
+    JobSystem(const JobSystem&) = delete;
+    JobSystem& operator=(const JobSystem&) = delete;
+
+    /// @brief Queue a job against @p fence.
+    void submit(JobFence& fence, Job job);
+
+    /// @brief Run queued jobs until @p fence drains.
+    ///
+    /// Rethrows the first exception a job of the fence threw.
+    void wait(JobFence& fence);
+
+    /// @brief Call fn(begin, end) over [0, count) in chunks of @p grain.
+    ///
+    /// Blocks until every chunk ran. The caller runs the first chunk itself.
+    /// @param count Number of items.
+    /// @param grain Items per chunk (at least 1).
+    /// @param fn Chunk body; called concurrently for disjoint ranges.
+    void parallel_for(std::size_t count, std::size_t grain,
+                      const std::function<void(std::size_t, std::size_t)>& fn);
+
+    /// @brief Number of worker threads (excluding callers).
+    [[nodiscard]] std::size_t worker_count() const { return threads_.size(); }
+
+    /// @brief hardware_concurrency() - 1, at least 1.
+    [[nodiscard]] static std::size_t default_worker_count();
+
+  private:
+    struct Task {
+        Job job;                   ///< The work.
+        JobFence* fence = nullptr; ///< Fence to signal when done.
+    };
+
+    struct Queue {
+        std::mutex mutex;       ///< Guards tasks.
+        std::deque<Task> tasks; ///< Owner uses the back, thieves the front.
+    };
+
+    [[nodiscard]] std::size_t home_queue() const;
+    bool try_run_one(std::size_t home);
+    void run(Task& task);
+    void worker_loop(std::size_t index);
+
+    std::vector<std::unique_ptr<Queue>> queues_; ///< Per worker, then the injection deque.
+    std::vector<std::thread> threads_;
+
+    std::mutex sleep_mutex_;             ///< Guards stop_ and pairs with wake_.
+    std::condition_variable wake_;       ///< Signals new jobs and finished jobs.
+    std::atomic<std::size_t> queued_{0}; ///< Jobs sitting in any deque.
+    bool stop_ = false;
+};
+
+/// @brief The JobSystem published in the registry ctx, or nullptr (unit tests).
+[[nodiscard]] inline JobSystem* find_jobs(const entt::registry& reg) {
+    auto* const* jobs = reg.ctx().find<JobSystem*>();
+    return jobs ? *jobs : nullptr;
+}
+
+/// @brief JobSystem::parallel_for, or one inline call when @p jobs is null.
+template <typename Fn>
+void parallel_for(JobSystem* jobs, std::size_t count, std::size_t grain, Fn&& fn) {
+    if (count == 0) {
+        return;
+    }
+    if (!jobs) {
+        fn(std::size_t{0}, count);
+        return;
+    }
+    jobs->parallel_for(count, grain, std::forward<Fn>(fn));
+}
+
+/// @brief Call fn(entity, components...) for every entity of an EnTT view or
+/// storage, spreading chunks of the packed entity array over the workers.
+///
+/// Same arguments as each(). The body may write the components it is handed
+/// but must not emplace, remove, create or destroy: collect those and apply
+/// them after this returns. Look up any other storage it reads before the
+/// call, since reg.storage<T>() may create one.
+/// @param jobs Job system, or null to run inline.
+/// @param source A view (reg.view<...>()) or a storage (reg.storage<T>()).
+/// @param grain Entities per chunk.
+/// @param fn Per-entity body.
+template <typename Source, typename Fn>
+void parallel_each(JobSystem* jobs, Source& source, std::size_t grain, Fn&& fn) {
+    const entt::sparse_set* handle = nullptr;
+    if constexpr (requires { source.handle(); }) {
+        handle = source.handle();
+    } else {
+        handle = &source;
+    }
+    if (!handle) {
+        return;
+    }
+
+    parallel_for(jobs, handle->size(), grain, [&](std::size_t begin, std::size_t end) {
+        auto first = handle->begin();
+        for (std::size_t i = begin; i < end; ++i) {
+            const auto entity = *(first + static_cast<std::ptrdiff_t>(i));
+            if (entity == entt::tombstone || !source.contains(entity)) {
+                continue;
+            }
+            if constexpr (requires { source.handle(); }) {
+                std::apply(fn, std::tuple_cat(std::make_tuple(entity), source.get(entity)));
+            } else {
+                std::apply(fn,
+                           std::tuple_cat(std::make_tuple(entity), source.get_as_tuple(entity)));
+            }
+        }
+    });
+}
+
+} // namespace raven
@@ -0,0 +1,80 @@
+#pragma once
+
+#include <chrono>
+#include <functional>
+#include <future>
+#include <optional>
+#include <string>
+#include <utility>
+
+namespace raven {
+
+/// @brief One background load, keyed by name, picked up later on demand.
+///
+/// start() runs the loader on its own thread; take() hands back the result
+/// if it was started for the same key, waiting for it to finish if needed.
+/// Loads block on disk, so they get a thread of their own rather than a
+/// JobSystem job: a worker helping in wait() could otherwise pick one up in
+/// the middle of a tick.
+///
+/// The loader must not touch the renderer or the registry.
+template <typename T> class Prefetch {
+  public:
+    Prefetch() = default;
+    ~Prefetch() { cancel(); }
+
+    Prefetch(const Prefetch&) = delete;
+    Prefetch& operator=(const Prefetch&) = delete;
+
+    /// @brief Start loading @p key, dropping any previous load.
+    /// @param key Name the result is claimed by.
+    /// @param load Loader run on the background thread.
+    void start(std::string key, std::function<T()> load) {
+        cancel();
+        key_ = std::move(key);
+        result_ = std::async(std::launch::async, std::move(load));
+    }
+
+    /// @brief Claim the load for @p key.
+    ///
+    /// Waits if it is still running. Rethrows what the loader threw.
+    /// @return The loaded value, or nullopt if nothing was started for @p key
+    ///         (a load for another key is dropped).
+    [[nodiscard]] std::optional<T> take(const std::string& key) {
+        if (!result_.valid()) {
+            return std::nullopt;
+        }
+        if (key_ != key) {
+            cancel();
+            return std::nullopt;
+        }
+        key_.clear();
+        return result_.get();
+    }
+
+    /// @brief Whether a load for @p key is running or waiting to be taken.
+    [[nodiscard]] bool pending(const std::string& key) const {
+        return result_.valid() && key_ == key;
+    }
+
+    /// @brief Whether the current load has finished (take() will not block).
+    [[nodiscard]] bool ready() const {
+        return result_.valid() &&
+               result_.wait_for(std::chrono::seconds(0)) == std::future_status::ready;
+    }
+
+    /// @brief Wait for and discard the current load, if any.
+    void cancel() {
+        if (result_.valid()) {
+            result_.wait();
+            result_ = {};
+        }
+        key_.clear();
+    }
+
+  private:
+    std::string key_;       ///< Key the running load was started for.
+    std::future<T> result_; ///< Result of the running load.
+};
+
+} // namespace raven
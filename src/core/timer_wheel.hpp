@@ -0,0 +1,131 @@
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+namespace raven {
+
+/// @brief Hierarchical timer wheel keyed on fixed-tick deadlines.
+///
+/// Four levels of 256 slots each cover 2^32 ticks (over a year at 120 Hz).
+/// Level 0 holds timers due within the next 256 ticks, one slot per tick.
+/// Each higher level covers 256x the span of the one below. When the lower
+/// levels wrap, the matching higher slot is cascaded down. advance() only
+/// touches the slot that is due (plus an occasional cascade), so per-tick
+/// cost scales with the number of expirations, not with the number of
+/// pending timers.
+///
+/// Timers cannot be cancelled. Callers store the deadline alongside the
+/// owning object and ignore fired entries whose deadline no longer matches.
+///
+/// @tparam Payload Trivially copyable value handed back when the timer fires.
+template <typename Payload>
+class TimerWheel {
+  public:
+    static constexpr int LEVELS = 4;                      ///< Wheel levels.
+    static constexpr int SLOT_BITS = 8;                   ///< log2(slots per level).
+    static constexpr std::size_t SLOTS = 1u << SLOT_BITS; ///< Slots per level.
+
+    /// @brief One pending timer.
+    struct Entry {
+        uint64_t deadline; ///< Tick at which the timer fires.
+        Payload payload;   ///< Caller data.
+    };
+
+    /// @brief Start the wheel at a given tick (discards pending timers).
+    /// @param now The last tick considered processed.
+    void reset(uint64_t now) {
+        now_ = now;
+        size_ = 0;
+        for (auto& level : levels_) {
+            for (auto& slot : level) {
+                slot.clear();
+            }
+        }
+    }
+
+    /// @brief Schedule a timer.
+    /// @param deadline Tick to fire at. Past deadlines fire on the next advance().
+    /// @param payload Value passed back to the callback.
+    void schedule(uint64_t deadline, Payload payload) {
+        if (deadline <= now_) {
+            deadline = now_ + 1;
+        }
+        place({deadline, payload});
+        ++size_;
+    }
+
+    /// @brief Process every tick up to and including @p to, firing due timers.
+    /// @param to Target tick (no-op if not ahead of the current tick).
+    /// @param fire Callable as fire(const Entry&). It may schedule new timers.
+    template <typename Fn>
+    void advance(uint64_t to, Fn&& fire) {
+        while (now_ < to) {
+            ++now_;
+            cascade();
+
+            auto& slot = levels_[0][index(now_, 0)];
+            if (slot.empty()) {
+                continue;
+            }
+
+            // Swap out so callbacks can schedule into this slot safely
+            std::swap(firing_, slot);
+            size_ -= firing_.size();
+            for (const auto& entry : firing_) {
+                fire(entry);
+            }
+            firing_.clear();
+        }
+    }
+
+    /// @brief The last processed tick.
+    [[nodiscard]] uint64_t now() const { return now_; }
+
+    /// @brief Number of pending timers (including stale ones).
+    [[nodiscard]] std::size_t size() const { return size_; }
+
+  private:
+    using Slot = std::vector<Entry>;
+
+    std::array<std::array<Slot, SLOTS>, LEVELS> levels_{};
+    Slot firing_;
+    Slot cascading_;
+    uint64_t now_ = 0;
+    std::size_t size_ = 0;
+
+    [[nodiscard]] static std::size_t index(uint64_t tick, int level) {
+        return static_cast<std::size_t>((tick >> (level * SLOT_BITS)) & (SLOTS - 1));
+    }
+
+    /// @brief Put an entry on the lowest level whose span covers its delay.
+    void place(const Entry& entry) {
+        uint64_t delta = entry.deadline - now_;
+        int level = 0;
+        while (level < LEVELS - 1 && delta >= (uint64_t{1} << ((level + 1) * SLOT_BITS))) {
+            ++level;
+        }
+        levels_[static_cast<std::size_t>(level)][index(entry.deadline, level)].push_back(entry);
+    }
+
+    /// @brief Redistribute higher-level slots whose span starts at now_.
+    void cascade() {
+        for (int level = 1; level < LEVELS; ++level) {
+            // Only when every lower level has wrapped to slot 0
+            if ((now_ & ((uint64_t{1} << (level * SLOT_BITS)) - 1)) != 0) {
+                break;
+            }
+            auto& slot = levels_[static_cast<std::size_t>(level)][index(now_, level)];
+            std::swap(cascading_, slot);
+            for (const auto& entry : cascading_) {
+                place(entry);
+            }
+            cascading_.clear();
+        }
+    }
+};
+
+} // namespace raven
@@ -0,0 +1,53 @@
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <cstdint>
+
+namespace raven {
+
+/// @brief Single-producer, single-consumer triple buffer.
+///
+/// The writer fills write_buffer() and publish()es it; the reader calls
+/// read_buffer() and always gets the most recently published value. The
+/// two sides never touch the same slot, and neither ever blocks: the writer
+/// may publish several times between reads (the reader skips to the newest)
+/// and the reader may read the same value for several frames.
+///
+/// Slots are reused, so T's containers keep their capacity across frames.
+template <typename T> class TripleBuffer {
+  public:
+    /// @brief The slot the writer owns. Stays valid until publish().
+    [[nodiscard]] T& write_buffer() { return slots_[back_]; }
+
+    /// @brief Hand the write slot to the reader and take a free one.
+    void publish() {
+        auto old = middle_.exchange(static_cast<uint8_t>(back_ | FRESH), std::memory_order_acq_rel);
+        back_ = static_cast<uint8_t>(old & INDEX);
+    }
+
+    /// @brief The newest published value. Stays valid until the next call.
+    [[nodiscard]] const T& read_buffer() {
+        if (middle_.load(std::memory_order_relaxed) & FRESH) {
+            auto old = middle_.exchange(front_, std::memory_order_acq_rel);
+            front_ = static_cast<uint8_t>(old & INDEX);
+        }
+        return slots_[front_];
+    }
+
+    /// @brief Whether anything was published since the last read_buffer().
+    [[nodiscard]] bool has_fresh() const {
+        return (middle_.load(std::memory_order_acquire) & FRESH) != 0;
+    }
+
+  private:
+    static constexpr uint8_t INDEX = 0x3;
+    static constexpr uint8_t FRESH = 0x4;
+
+    std::array<T, 3> slots_{};
+    uint8_t back_ = 0;               ///< Writer's slot.
+    std::atomic<uint8_t> middle_{1}; ///< Last published slot, FRESH until read.
+    uint8_t front_ = 2;              ///< Reader's slot.
+};
+
+} // namespace raven
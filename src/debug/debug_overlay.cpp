@@ -3,6 +3,7 @@
 #include "debug/debug_overlay.hpp"
 
 #include "ecs/components.hpp"
+#include "ecs/systems/bullet_pool.hpp"
 
 #include <imgui.h>
 #include <imgui_impl_sdl3.h>
@@ -46,21 +47,23 @@ void DebugOverlay::begin_frame() {
     ImGui::NewFrame();
 }
 
-void DebugOverlay::render(SDL_Renderer* renderer, entt::registry& reg) {
+void DebugOverlay::render(SDL_Renderer* renderer, entt::registry& reg,
+                          const RenderStats& stats) {
     if (!visible_) {
         ImGui::EndFrame();
         return;
     }
 
-    panel_fps();
+    panel_fps(stats);
     panel_entities(reg);
     panel_player(reg);
+    panel_debug_draw(reg);
 
     ImGui::Render();
     ImGui_ImplSDLRenderer3_RenderDrawData(ImGui::GetDrawData(), renderer);
 }
 
-void DebugOverlay::panel_fps() {
+void DebugOverlay::panel_fps(const RenderStats& stats) {
     const ImGuiIO& io = ImGui::GetIO();
     float frame_ms = 1000.f / io.Framerate;
 
@@ -74,11 +77,12 @@ void DebugOverlay::panel_fps() {
     fps_avg_ = 1000.f / (sum / static_cast<float>(FRAME_HISTORY_SIZE));
 
     ImGui::SetNextWindowPos(ImVec2(5, 5), ImGuiCond_FirstUseEver);
-    ImGui::SetNextWindowSize(ImVec2(260, 120), ImGuiCond_FirstUseEver);
+    ImGui::SetNextWindowSize(ImVec2(260, 140), ImGuiCond_FirstUseEver);
     ImGui::Begin("FPS");
     ImGui::Text("FPS: %.1f (avg: %.1f)", static_cast<double>(io.Framerate),
                 static_cast<double>(fps_avg_));
     ImGui::Text("Frame: %.2f ms", static_cast<double>(frame_ms));
+    ImGui::Text("Draw calls: %d  Quads: %d", stats.draw_calls, stats.quads);
     ImGui::PlotLines("##frametime", frame_times_.data(), FRAME_HISTORY_SIZE, frame_index_, nullptr,
                      0.f, 33.3f, ImVec2(0, 40));
     ImGui::End();
@@ -96,6 +100,9 @@ void DebugOverlay::panel_entities(entt::registry& reg) {
     for ([[maybe_unused]] auto _ : reg.view<Bullet>()) {
         ++bullet_count;
     }
+    if (const auto* pool = reg.ctx().find<systems::BulletPool>()) {
+        bullet_count += pool->size();
+    }
     std::size_t enemy_count = 0;
     for ([[maybe_unused]] auto _ : reg.view<Enemy>()) {
         ++enemy_count;
@@ -135,6 +142,21 @@ void DebugOverlay::panel_player(entt::registry& reg) {
     ImGui::End();
 }
 
+void DebugOverlay::panel_debug_draw(entt::registry& reg) {
+    ImGui::SetNextWindowPos(ImVec2(270, 5), ImGuiCond_FirstUseEver);
+    ImGui::SetNextWindowSize(ImVec2(180, 120), ImGuiCond_FirstUseEver);
+    ImGui::Begin("Debug draw");
+
+    // Runs after the ticks have joined, so writing the ctx is safe; the
+    // next published snapshot picks the change up
+    auto& flags = reg.ctx().emplace<DebugDrawFlags>();
+    ImGui::Checkbox("Hitboxes", &flags.hitboxes);
+    ImGui::Checkbox("Melee cones", &flags.melee);
+    ImGui::Checkbox("Line of sight", &flags.sight);
+    ImGui::Checkbox("Collision grid", &flags.grid);
+    ImGui::End();
+}
+
 } // namespace raven
 
 #endif // RAVEN_ENABLE_IMGUI
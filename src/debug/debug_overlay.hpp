@@ -2,6 +2,8 @@
 
 #ifdef RAVEN_ENABLE_IMGUI
 
+#include "rendering/render_queue.hpp"
+
 #include <SDL3/SDL.h>
 #include <entt/entt.hpp>
 
@@ -13,7 +15,8 @@ namespace raven {
 
 /// @brief Dear ImGui debug overlay for real-time inspection and tuning.
 ///
-/// Displays FPS graphs, entity counts, and player state panels.
+/// Displays FPS graphs, entity counts, and player state panels, and toggles
+/// the in-game debug-draw layers (DebugDrawFlags).
 /// Toggle visibility with a key binding (typically F3).
 /// Conditionally compiled via RAVEN_ENABLE_IMGUI.
 class DebugOverlay {
@@ -37,7 +40,8 @@ class DebugOverlay {
     /// @brief Draw all debug panels and finalise ImGui rendering.
     /// @param renderer The SDL_Renderer to draw with.
     /// @param reg The ECS registry to inspect.
-    void render(SDL_Renderer* renderer, entt::registry& reg);
+    /// @param stats Batched draw counts of the frame just drawn.
+    void render(SDL_Renderer* renderer, entt::registry& reg, const RenderStats& stats);
 
     /// @brief Toggle overlay visibility on/off.
     void toggle() { visible_ = !visible_; }
@@ -55,7 +59,7 @@ class DebugOverlay {
     float fps_avg_ = 0.f; ///< Smoothed FPS average.
 
     /// @brief Draw the FPS counter and frame time graph.
-    void panel_fps();
+    void panel_fps(const RenderStats& stats);
 
     /// @brief Draw the entity count breakdown by component type.
     /// @param reg The ECS registry to inspect.
@@ -64,6 +68,10 @@ class DebugOverlay {
     /// @brief Draw the player state inspector panel.
     /// @param reg The ECS registry containing the player entity.
     void panel_player(entt::registry& reg);
+
+    /// @brief Draw the debug-draw layer toggles.
+    /// @param reg The ECS registry whose ctx holds the DebugDrawFlags.
+    void panel_debug_draw(entt::registry& reg);
 };
 
 } // namespace raven
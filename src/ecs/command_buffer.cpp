@@ -0,0 +1,34 @@
+#include "ecs/command_buffer.hpp"
+
+#include <algorithm>
+
+namespace raven {
+
+void CommandBuffer::flush(entt::registry& reg) {
+    for (auto& [id, q] : queues_) {
+        q->apply(reg);
+    }
+
+    if (destroys_.empty()) {
+        return;
+    }
+
+    // Deduplicate, drop stale handles, then destroy storage by storage
+    std::sort(destroys_.begin(), destroys_.end());
+    destroys_.erase(std::unique(destroys_.begin(), destroys_.end()), destroys_.end());
+    destroys_.erase(std::remove_if(destroys_.begin(), destroys_.end(),
+                                   [&reg](entt::entity e) { return !reg.valid(e); }),
+                    destroys_.end());
+    reg.destroy(destroys_.begin(), destroys_.end());
+    destroys_.clear();
+}
+
+bool CommandBuffer::empty() const {
+    if (!destroys_.empty()) {
+        return false;
+    }
+    return std::all_of(queues_.begin(), queues_.end(),
+                       [](const auto& entry) { return entry.second->empty(); });
+}
+
+} // namespace raven
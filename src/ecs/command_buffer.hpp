@@ -0,0 +1,142 @@
+#pragma once
+
+#include <entt/entt.hpp>
+
+#include <cstddef>
+#include <memory>
+#include <utility>
+#include <vector>
+
+namespace raven {
+
+/// @brief Tick-scoped queue of deferred structural registry changes (ADR 0007).
+///
+/// Systems record destroy, emplace and remove operations while iterating
+/// views; flush() applies them at one sync point per tick. Flush order is:
+/// component emplaces and removes (grouped per component type, in the order
+/// each type was first used), then destroys. Destroys are deduplicated and
+/// invalid handles are skipped, and the survivors are destroyed as one range
+/// so the registry walks each storage once.
+///
+/// GameScene keeps one in the registry ctx and flushes it in update();
+/// systems reach it through DeferredCommands, which falls back to a local
+/// buffer flushed at scope exit when none exists (unit tests).
+class CommandBuffer {
+  public:
+    /// @brief Queue an entity for destruction.
+    void destroy(entt::entity entity) { destroys_.push_back(entity); }
+
+    /// @brief Queue emplace_or_replace of a component.
+    /// @tparam T Component type.
+    /// @param entity Target entity (skipped at flush if no longer valid).
+    /// @param args Constructor arguments for T.
+    template <typename T, typename... Args>
+    void emplace(entt::entity entity, Args&&... args) {
+        queue<EmplaceQueue<T>>(entt::type_hash<EmplaceQueue<T>>::value())
+            .items.emplace_back(entity, T{std::forward<Args>(args)...});
+    }
+
+    /// @brief Queue removal of a component (no-op at flush if absent).
+    /// @tparam T Component type.
+    /// @param entity Target entity.
+    template <typename T>
+    void remove(entt::entity entity) {
+        queue<RemoveQueue<T>>(entt::type_hash<RemoveQueue<T>>::value()).items.push_back(entity);
+    }
+
+    /// @brief Apply every queued operation and clear the buffer.
+    /// @param reg The registry to modify.
+    void flush(entt::registry& reg);
+
+    /// @brief Whether nothing is queued.
+    [[nodiscard]] bool empty() const;
+
+    /// @brief Number of destroy requests queued (before deduplication).
+    [[nodiscard]] std::size_t pending_destroys() const { return destroys_.size(); }
+
+  private:
+    struct QueueBase {
+        virtual ~QueueBase() = default;
+        virtual void apply(entt::registry& reg) = 0;
+        [[nodiscard]] virtual bool empty() const = 0;
+    };
+
+    template <typename T>
+    struct EmplaceQueue final : QueueBase {
+        std::vector<std::pair<entt::entity, T>> items;
+
+        void apply(entt::registry& reg) override {
+            for (auto& [entity, value] : items) {
+                if (reg.valid(entity)) {
+                    reg.emplace_or_replace<T>(entity, std::move(value));
+                }
+            }
+            items.clear();
+        }
+        [[nodiscard]] bool empty() const override { return items.empty(); }
+    };
+
+    template <typename T>
+    struct RemoveQueue final : QueueBase {
+        std::vector<entt::entity> items;
+
+        void apply(entt::registry& reg) override {
+            for (auto entity : items) {
+                if (reg.valid(entity)) {
+                    reg.remove<T>(entity);
+                }
+            }
+            items.clear();
+        }
+        [[nodiscard]] bool empty() const override { return items.empty(); }
+    };
+
+    /// @brief Find or create the typed queue for a key (queues persist across flushes).
+    template <typename Q>
+    Q& queue(entt::id_type key) {
+        for (auto& [id, q] : queues_) {
+            if (id == key) {
+                return static_cast<Q&>(*q);
+            }
+        }
+        auto& entry = queues_.emplace_back(key, std::make_unique<Q>());
+        return static_cast<Q&>(*entry.second);
+    }
+
+    std::vector<entt::entity> destroys_;
+    std::vector<std::pair<entt::id_type, std::unique_ptr<QueueBase>>> queues_;
+};
+
+/// @brief The registry ctx CommandBuffer, or a local one flushed on scope exit.
+///
+/// Lets systems always defer structural changes: inside GameScene they land
+/// in the shared per-tick buffer; in isolated unit tests they are applied
+/// when the system returns, preserving immediate-looking behaviour.
+class DeferredCommands {
+  public:
+    /// @brief Bind to the ctx buffer if present.
+    explicit DeferredCommands(entt::registry& reg)
+        : reg_(reg), shared_(reg.ctx().find<CommandBuffer>()) {}
+
+    ~DeferredCommands() {
+        if (!shared_) {
+            local_.flush(reg_);
+        }
+    }
+
+    DeferredCommands(const DeferredCommands&) = delete;
+    DeferredCommands& operator=(const DeferredCommands&) = delete;
+
+    /// @brief The buffer to record into.
+    CommandBuffer& operator*() { return shared_ ? *shared_ : local_; }
+
+    /// @brief Member access to the buffer.
+    CommandBuffer* operator->() { return shared_ ? shared_ : &local_; }
+
+  private:
+    entt::registry& reg_;
+    CommandBuffer* shared_;
+    CommandBuffer local_;
+};
+
+} // namespace raven
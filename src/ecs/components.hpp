@@ -25,6 +25,23 @@ struct Velocity {
     float dy = 0.f; ///< Vertical speed in pixels/s.
 };
 
+/// @brief Closed-form bullet trajectory, evaluated from the spawn tick.
+///
+/// Bullets carrying this are not integrated: update_movement() evaluates the
+/// position at the current SimTick and the renderer evaluates it at t + alpha,
+/// so no PreviousTransform is needed. Velocity holds the derived
+/// instantaneous velocity for systems that read travel direction.
+struct BulletMotion {
+    uint64_t spawn_tick = 0;      ///< SimTick::tick during which the bullet spawned.
+    float origin_x = 0.f;         ///< Spawn X position in pixels.
+    float origin_y = 0.f;         ///< Spawn Y position in pixels.
+    float dir_x = 1.f;            ///< Unit initial heading X (cos of the spawn angle).
+    float dir_y = 0.f;            ///< Unit initial heading Y (sin of the spawn angle).
+    float speed = 0.f;            ///< Initial speed in pixels/sec.
+    float angular_velocity = 0.f; ///< Heading change in radians/sec.
+    float acceleration = 0.f;     ///< Speed change in pixels/sec^2 (negative slows).
+};
+
 // ── Interpolation ───────────────────────────────────────────────
 
 /// @brief Stores the previous tick's position for render interpolation.
@@ -112,7 +129,8 @@ struct Bullet {
 
 /// @brief Remaining lifetime before automatic despawn.
 struct Lifetime {
-    float remaining = 5.f; ///< Seconds until the entity is destroyed.
+    float remaining = 5.f;     ///< Seconds until the entity is destroyed.
+    uint64_t expires_tick = 0; ///< Deadline tick when ExpiryTimers is active.
 };
 
 /// @brief Deals damage on collision with an applicable target.
@@ -122,7 +140,8 @@ struct DamageOnContact {
 
 /// @brief Temporary invulnerability (e.g. after taking a hit).
 struct Invulnerable {
-    float remaining = 0.f; ///< Seconds of invulnerability left.
+    float remaining = 0.f;     ///< Seconds of invulnerability left.
+    uint64_t expires_tick = 0; ///< Deadline tick when ExpiryTimers is active.
 };
 
 /// @brief Score value awarded when this entity is destroyed.
@@ -187,12 +206,35 @@ struct Weapon {
 
 // ── Emitter ─────────────────────────────────────────────────────
 
+/// @brief Dense index of a PatternDef inside a PatternLibrary. Trivially copyable.
+///
+/// Assigned at load time and stable for the library's lifetime (reloading a
+/// pattern under the same name keeps its id).
+struct PatternId {
+    static constexpr uint16_t NONE = 0xFFFF;    ///< Sentinel for "not resolved".
+    static constexpr uint16_t MISSING = 0xFFFE; ///< Sentinel for "resolved, not loaded".
+    static constexpr uint16_t MAX = MISSING;    ///< Number of assignable ids.
+
+    uint16_t value = NONE; ///< Index into the library's pattern array.
+
+    /// @brief Check if this ID refers to a loaded pattern.
+    /// @return True if the ID is neither sentinel.
+    [[nodiscard]] bool valid() const { return value < MAX; }
+
+    /// @brief Check if a lookup has been attempted (valid or MISSING).
+    [[nodiscard]] bool resolved() const { return value != NONE; }
+
+    bool operator==(const PatternId&) const = default;
+    bool operator!=(const PatternId&) const = default;
+};
+
 /// @brief Drives a bullet pattern from the pattern library on an entity.
 struct BulletEmitter {
     StringId pattern_name;             ///< Interned name of the PatternDef to execute.
     std::vector<float> cooldowns;      ///< Per-emitter cooldown timers (seconds).
     std::vector<float> current_angles; ///< Per-emitter current rotation angles (degrees).
     bool active = true;                ///< Whether this emitter is currently firing.
+    PatternId pattern_id;              ///< Cached library id (resolved from pattern_name).
 };
 
 // ── Pickup / Decay ──────────────────────────────────────────────
@@ -377,6 +419,33 @@ struct Exit {
     bool open = false;        ///< Active only after room is cleared.
 };
 
+// ── Collision ───────────────────────────────────────────────────
+
+/// @brief One bullet-vs-actor overlap found by the collision phase.
+struct Contact {
+    /// @brief Which side of the fight the contact belongs to.
+    enum class Kind : uint8_t {
+        PlayerHit, ///< Enemy bullet overlapped a player.
+        EnemyHit,  ///< Player bullet overlapped an enemy.
+    };
+
+    entt::entity source = entt::null; ///< The bullet.
+    entt::entity target = entt::null; ///< The actor that was hit.
+    Kind kind = Kind::EnemyHit;
+    float nx = 0.f;     ///< Unit impact direction X (bullet travel; 0 if stationary).
+    float ny = 0.f;     ///< Unit impact direction Y (bullet travel; 0 if stationary).
+    float damage = 0.f; ///< DamageOnContact value of the bullet.
+};
+
+/// @brief Registry-context list of contacts detected this tick.
+///
+/// Collision detection only appends here; damage, knockback, audio and
+/// bullet destruction each consume the whole buffer in one pass so
+/// structural registry changes happen once per tick, not once per hit.
+struct ContactBuffer {
+    std::vector<Contact> contacts; ///< Contacts in detection order.
+};
+
 // ── Audio ───────────────────────────────────────────────────────
 
 /// @brief Sound effect identifiers, mapped to loaded sounds by GameScene.
@@ -433,6 +502,45 @@ inline void push_sfx(entt::registry& reg, Sfx sfx) {
 
 // ── Game Context (registry singleton) ──────────────────────────
 
+/// @brief Fixed ticks simulated by the active GameScene.
+///
+/// Seeded from Clock::tick_count on scene entry and advanced at the start of
+/// each GameScene::update(). Unlike the clock it does not advance while the
+/// game is paused, so BulletMotion bullets do not jump on resume.
+struct SimTick {
+    uint64_t tick = 0; ///< Index of the tick being (or last) simulated.
+};
+
+/// @brief View into a level that may be larger than the screen.
+///
+/// update_camera() centres it on the player each tick and keeps it inside
+/// the level. Rendering interpolates between prev and current like sprites;
+/// off-screen despawn and tile culling use the current view.
+struct Camera {
+    float x = 0.f;         ///< Left edge of the view in world pixels.
+    float y = 0.f;         ///< Top edge of the view in world pixels.
+    float prev_x = 0.f;    ///< x at the previous tick.
+    float prev_y = 0.f;    ///< y at the previous tick.
+    float width = 480.f;   ///< View width (Renderer::VIRTUAL_WIDTH).
+    float height = 270.f;  ///< View height (Renderer::VIRTUAL_HEIGHT).
+    float world_w = 480.f; ///< Level width; the view and the player stay inside.
+    float world_h = 270.f; ///< Level height.
+};
+
+/// @brief Registry-context toggles for the debug-draw layer.
+///
+/// Set from the DebugOverlay (between ticks); read by extract_debug_draw()
+/// when a snapshot is published. Nothing is recorded while all are off.
+struct DebugDrawFlags {
+    bool hitboxes = false; ///< CircleHitbox and RectHitbox outlines, pooled bullets included.
+    bool melee = false;    ///< Active MeleeAttack cones.
+    bool sight = false;    ///< AI line-of-sight rays to the player.
+    bool grid = false;     ///< Occupied cells of the collision broad-phase.
+
+    /// @brief Whether any layer is on.
+    [[nodiscard]] bool any() const { return hitboxes || melee || sight || grid; }
+};
+
 /// @brief Persistent session state stored in registry context.
 struct GameState {
     int score = 0;             ///< Accumulated score for the session.
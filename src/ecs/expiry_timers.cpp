@@ -0,0 +1,104 @@
+#include "ecs/expiry_timers.hpp"
+
+#include "core/clock.hpp"
+#include "ecs/command_buffer.hpp"
+#include "ecs/components.hpp"
+
+#include <algorithm>
+#include <cmath>
+
+namespace {
+
+/// @brief Signal hook: stamp and schedule a freshly emplaced/replaced component.
+template <typename T, raven::ExpiryTimers::Kind K>
+void schedule_expiry(entt::registry& reg, entt::entity entity) {
+    auto* timers = reg.ctx().find<raven::ExpiryTimers>();
+    if (!timers) {
+        return;
+    }
+    auto& comp = reg.get<T>(entity);
+    comp.expires_tick = timers->deadline(comp.remaining);
+    timers->wheel.schedule(comp.expires_tick, {entity, K});
+}
+
+template <typename T, raven::ExpiryTimers::Kind K>
+void connect_expiry(entt::registry& reg) {
+    reg.on_construct<T>().template connect<&schedule_expiry<T, K>>();
+    reg.on_update<T>().template connect<&schedule_expiry<T, K>>();
+}
+
+template <typename T, raven::ExpiryTimers::Kind K>
+void disconnect_expiry(entt::registry& reg) {
+    reg.on_construct<T>().template disconnect<&schedule_expiry<T, K>>();
+    reg.on_update<T>().template disconnect<&schedule_expiry<T, K>>();
+}
+
+} // namespace
+
+namespace raven {
+
+uint64_t ExpiryTimers::deadline(float seconds) const {
+    // Same step count as `remaining -= dt` until <= 0, minus float drift
+    float steps = std::ceil(seconds / Clock::TICK_RATE - 0.001f);
+    return tick + static_cast<uint64_t>(std::max(steps, 1.f));
+}
+
+void enable_expiry_timers(entt::registry& reg, uint64_t start_tick) {
+    reg.ctx().erase<ExpiryTimers>();
+    auto& timers = reg.ctx().emplace<ExpiryTimers>();
+    timers.tick = start_tick;
+    timers.wheel.reset(start_tick);
+
+    // Disconnect first so re-entering a scene does not double the hooks
+    disconnect_expiry<Lifetime, ExpiryTimers::Kind::Lifetime>(reg);
+    disconnect_expiry<Invulnerable, ExpiryTimers::Kind::Invulnerable>(reg);
+    connect_expiry<Lifetime, ExpiryTimers::Kind::Lifetime>(reg);
+    connect_expiry<Invulnerable, ExpiryTimers::Kind::Invulnerable>(reg);
+}
+
+void disable_expiry_timers(entt::registry& reg) {
+    disconnect_expiry<Lifetime, ExpiryTimers::Kind::Lifetime>(reg);
+    disconnect_expiry<Invulnerable, ExpiryTimers::Kind::Invulnerable>(reg);
+    reg.ctx().erase<ExpiryTimers>();
+}
+
+void advance_expiry_timers(entt::registry& reg, ExpiryTimers& timers, CommandBuffer& cmds) {
+    ++timers.tick;
+    timers.wheel.advance(timers.tick, [&](const auto& entry) {
+        auto entity = entry.payload.entity;
+        if (!reg.valid(entity)) {
+            return;
+        }
+        switch (entry.payload.kind) {
+        case ExpiryTimers::Kind::Lifetime:
+            if (auto* life = reg.try_get<Lifetime>(entity);
+                life && life->expires_tick == entry.deadline) {
+                cmds.destroy(entity);
+            }
+            break;
+        case ExpiryTimers::Kind::Invulnerable:
+            if (auto* inv = reg.try_get<Invulnerable>(entity);
+                inv && inv->expires_tick == entry.deadline) {
+                reg.remove<Invulnerable>(entity);
+            }
+            break;
+        }
+    });
+}
+
+void extend_invulnerability(entt::registry& reg, entt::entity entity, float seconds) {
+    auto* inv = reg.try_get<Invulnerable>(entity);
+    if (auto* timers = reg.ctx().find<ExpiryTimers>()) {
+        if (!inv || inv->expires_tick < timers->deadline(seconds)) {
+            reg.emplace_or_replace<Invulnerable>(entity, seconds);
+        }
+        return;
+    }
+    if (!inv) {
+        reg.emplace<Invulnerable>(entity, seconds);
+    } else {
+        inv->remaining = std::max(inv->remaining, seconds);
+    }
+}
+
+} // namespace raven
@@ -0,0 +1,68 @@
+#pragma once
+
+#include "core/timer_wheel.hpp"
+
+#include <entt/entt.hpp>
+
+#include <cstdint>
+
+namespace raven {
+
+class CommandBuffer;
+
+/// @brief Deadline-driven expiry for Lifetime and Invulnerable.
+///
+/// When present in the registry ctx, emplacing or replacing either component
+/// stamps its expires_tick and schedules it on a TimerWheel. update_cleanup
+/// then advances the wheel by one tick and only touches the entries that are
+/// due, instead of decrementing every component's float countdown. In that
+/// mode `remaining` keeps the duration the component was granted with.
+///
+/// Without it (unit tests, other scenes) the float countdowns are used.
+struct ExpiryTimers {
+    /// @brief Which component a timer belongs to.
+    enum class Kind : uint8_t { Lifetime, Invulnerable };
+
+    /// @brief Wheel payload.
+    struct Timer {
+        entt::entity entity = entt::null; ///< Owning entity.
+        Kind kind = Kind::Lifetime;       ///< Component to expire.
+    };
+
+    TimerWheel<Timer> wheel; ///< Pending deadlines.
+    uint64_t tick = 0;       ///< Last fixed tick processed by update_cleanup.
+
+    /// @brief Deadline tick for a duration granted during the current tick.
+    ///
+    /// Matches the float countdown: a duration lasting n fixed steps expires
+    /// in the cleanup pass n - 1 ticks from now.
+    /// @param seconds Duration in seconds.
+    /// @return The tick at which the timer fires.
+    [[nodiscard]] uint64_t deadline(float seconds) const;
+};
+
+/// @brief Install ExpiryTimers in the ctx and hook the component signals.
+/// @param reg The ECS registry.
+/// @param start_tick Current fixed tick (Clock::tick_count).
+void enable_expiry_timers(entt::registry& reg, uint64_t start_tick);
+
+/// @brief Remove ExpiryTimers and disconnect the component signals.
+/// @param reg The ECS registry.
+void disable_expiry_timers(entt::registry& reg);
+
+/// @brief Advance the wheel by one tick and expire due components.
+///
+/// Lifetime expiry queues a destroy in @p cmds; Invulnerable is removed
+/// immediately. Stale entries (component replaced or entity gone) are skipped.
+/// @param reg The ECS registry.
+/// @param timers The ctx ExpiryTimers.
+/// @param cmds Command buffer receiving destroy requests.
+void advance_expiry_timers(entt::registry& reg, ExpiryTimers& timers, CommandBuffer& cmds);
+
+/// @brief Grant at least @p seconds of invulnerability, never shortening it.
+/// @param reg The ECS registry.
+/// @param entity Target entity.
+/// @param seconds Minimum invulnerability from now, in seconds.
+void extend_invulnerability(entt::registry& reg, entt::entity entity, float seconds);
+
+} // namespace raven
@@ -0,0 +1,99 @@
+#include "ecs/system_scheduler.hpp"
+
+#include <algorithm>
+#include <utility>
+
+namespace {
+
+bool intersects(const std::vector<entt::id_type>& a, const std::vector<entt::id_type>& b) {
+    return std::any_of(a.begin(), a.end(), [&b](entt::id_type id) {
+        return std::find(b.begin(), b.end(), id) != b.end();
+    });
+}
+
+} // namespace
+
+namespace raven {
+
+void SystemAccess::add_id(std::vector<entt::id_type>& ids, entt::id_type id) {
+    if (std::find(ids.begin(), ids.end(), id) == ids.end()) {
+        ids.push_back(id);
+    }
+}
+
+bool SystemAccess::conflicts_with(const SystemAccess& other) const {
+    if (exclusive_ || other.exclusive_) {
+        return true;
+    }
+    return intersects(writes_, other.writes_) || intersects(writes_, other.reads_) ||
+           intersects(reads_, other.writes_);
+}
+
+void SystemAccess::prepare(entt::registry& reg) const {
+    for (auto fn : prepare_) {
+        fn(reg);
+    }
+}
+
+void SystemScheduler::add(std::string name, SystemAccess access, std::function<void()> system) {
+    std::size_t index = nodes_.size();
+    Node node{std::move(name), std::move(access), std::move(system), {}, {}};
+
+    for (std::size_t i = 0; i < index; ++i) {
+        if (nodes_[i].access.conflicts_with(node.access)) {
+            node.dependencies.push_back(i);
+            nodes_[i].dependents.push_back(index);
+        }
+    }
+    nodes_.push_back(std::move(node));
+}
+
+void SystemScheduler::clear() {
+    nodes_.clear();
+}
+
+void SystemScheduler::prepare(entt::registry& reg) const {
+    for (const auto& node : nodes_) {
+        node.access.prepare(reg);
+    }
+}
+
+void SystemScheduler::run_serial() {
+    for (auto& node : nodes_) {
+        node.system();
+    }
+}
+
+void SystemScheduler::run() {
+    if (!jobs_ || jobs_->worker_count() == 0) {
+        run_serial();
+        return;
+    }
+
+    if (pending_.size() != nodes_.size()) {
+        pending_ = std::vector<std::atomic<std::size_t>>(nodes_.size());
+    }
+    for (std::size_t i = 0; i < nodes_.size(); ++i) {
+        pending_[i].store(nodes_[i].dependencies.size(), std::memory_order_relaxed);
+    }
+
+    // One fence per tick: finished systems submit their dependents against it
+    JobFence fence;
+    for (std::size_t i = 0; i < nodes_.size(); ++i) {
+        if (nodes_[i].dependencies.empty()) {
+            jobs_->submit(fence, [this, &fence, i] { run_node(fence, i); });
+        }
+    }
+    jobs_->wait(fence);
+}
+
+void SystemScheduler::run_node(JobFence& fence, std::size_t index) {
+    nodes_[index].system();
+    for (std::size_t dependent : nodes_[index].dependents) {
+        if (pending_[dependent].fetch_sub(1, std::memory_order_acq_rel) == 1) {
+            jobs_->submit(fence, [this, &fence, dependent] { run_node(fence, dependent); });
+        }
+    }
+}
+
+} // namespace raven
@@ -0,0 +1,177 @@
+#pragma once
+
+#include "core/jobs.hpp"
+
+#include <entt/entt.hpp>
+
+#include <atomic>
+#include <cstddef>
+#include <functional>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace raven {
+
+/// @brief Components and ctx singletons one system touches.
+///
+/// Built fluently and handed to SystemScheduler::add:
+///
+///     SystemAccess{}.reads<Player, Transform2D>().writes<Velocity>().writes_ctx<AudioQueue>()
+///
+/// Two systems conflict when one writes a type the other reads or writes.
+/// Structural changes count as writes: emplacing or removing T writes T's
+/// storage, and creating entities writes the entity storage (creates_entities).
+/// Emplacing Lifetime or Invulnerable also writes ExpiryTimers through its
+/// signal hooks, so those systems declare it too.
+class SystemAccess {
+  public:
+    /// @brief Declare component types the system only reads.
+    template <typename... T>
+    SystemAccess& reads() {
+        (add_component<T>(reads_), ...);
+        return *this;
+    }
+
+    /// @brief Declare component types the system writes, emplaces or removes.
+    template <typename... T>
+    SystemAccess& writes() {
+        (add_component<T>(writes_), ...);
+        return *this;
+    }
+
+    /// @brief Declare ctx singletons the system only reads.
+    template <typename... T>
+    SystemAccess& reads_ctx() {
+        (add_id(reads_, entt::type_hash<T>::value()), ...);
+        return *this;
+    }
+
+    /// @brief Declare ctx singletons the system writes.
+    template <typename... T>
+    SystemAccess& writes_ctx() {
+        (add_id(writes_, entt::type_hash<T>::value()), ...);
+        return *this;
+    }
+
+    /// @brief Declare ctx scratch the system creates on first use and writes.
+    ///
+    /// Inserting into the ctx is not safe while other systems look values up,
+    /// so SystemScheduler::prepare emplaces these ahead of time.
+    template <typename... T>
+    SystemAccess& scratch() {
+        (add_scratch<T>(), ...);
+        return *this;
+    }
+
+    /// @brief Declare that the system creates entities.
+    SystemAccess& creates_entities() { return writes<entt::entity>(); }
+
+    /// @brief Conflict with every other system (unknown or registry-wide effects).
+    SystemAccess& exclusive() {
+        exclusive_ = true;
+        return *this;
+    }
+
+    /// @brief Whether running this system concurrently with @p other could race.
+    [[nodiscard]] bool conflicts_with(const SystemAccess& other) const;
+
+    /// @brief Create every declared component storage and ctx scratch value.
+    /// @param reg The registry the system runs against.
+    void prepare(entt::registry& reg) const;
+
+  private:
+    using Prepare = void (*)(entt::registry&);
+
+    static void add_id(std::vector<entt::id_type>& ids, entt::id_type id);
+
+    template <typename T>
+    void add_component(std::vector<entt::id_type>& ids) {
+        add_id(ids, entt::type_hash<T>::value());
+        prepare_.push_back([](entt::registry& reg) { static_cast<void>(reg.storage<T>()); });
+    }
+
+    template <typename T>
+    void add_scratch() {
+        add_id(writes_, entt::type_hash<T>::value());
+        prepare_.push_back([](entt::registry& reg) { static_cast<void>(reg.ctx().emplace<T>()); });
+    }
+
+    std::vector<entt::id_type> reads_;  ///< Type ids read (components and ctx).
+    std::vector<entt::id_type> writes_; ///< Type ids written (components and ctx).
+    std::vector<Prepare> prepare_;      ///< Storage/ctx creation run by prepare().
+    bool exclusive_ = false;            ///< Conflicts with everything.
+};
+
+/// @brief Runs a fixed list of systems, concurrently where their data allows.
+///
+/// Systems are added in today's serial order. Each later system depends on
+/// every earlier one it conflicts with (SystemAccess::conflicts_with), which
+/// keeps that order wherever it matters and leaves the rest free to overlap.
+/// Conflicting systems always run in declaration order, so run() produces
+/// the same registry state as run_serial() tick for tick.
+///
+/// EnTT tolerates concurrent access to distinct storages but not storage or
+/// ctx creation racing with lookups; call prepare() once after adding the
+/// systems so every declared storage and scratch value already exists.
+class SystemScheduler {
+  public:
+    /// @brief Construct with the pool that runs ready systems.
+    /// @param jobs Job system, or null to always run serially.
+    explicit SystemScheduler(JobSystem* jobs = nullptr) : jobs_(jobs) {}
+
+    /// @brief Change the job system (null runs serially).
+    void set_jobs(JobSystem* jobs) { jobs_ = jobs; }
+
+    /// @brief Append a system after all previously added ones.
+    /// @param name Display name for logging and tests.
+    /// @param access What the system reads and writes.
+    /// @param system The callable to run once per tick.
+    void add(std::string name, SystemAccess access, std::function<void()> system);
+
+    /// @brief Remove every system.
+    void clear();
+
+    /// @brief Create the storages and ctx scratch declared by every system.
+    /// @param reg The registry the systems run against.
+    void prepare(entt::registry& reg) const;
+
+    /// @brief Run every system once, overlapping independent ones.
+    ///
+    /// Ready systems are submitted to the JobSystem as they become ready and
+    /// the caller helps run them. Returns when all systems have finished. The
+    /// first exception thrown by a system is rethrown; systems that depend
+    /// on it are skipped.
+    void run();
+
+    /// @brief Run every system once on the caller, in declaration order.
+    void run_serial();
+
+    /// @brief Number of systems.
+    [[nodiscard]] std::size_t size() const { return nodes_.size(); }
+
+    /// @brief Name of system @p index.
+    [[nodiscard]] std::string_view name(std::size_t index) const { return nodes_[index].name; }
+
+    /// @brief Earlier systems that system @p index must wait for.
+    [[nodiscard]] const std::vector<std::size_t>& dependencies(std::size_t index) const {
+        return nodes_[index].dependencies;
+    }
+
+  private:
+    struct Node {
+        std::string name;                      ///< Display name.
+        SystemAccess access;                   ///< Declared reads/writes.
+        std::function<void()> system;          ///< The work.
+        std::vector<std::size_t> dependencies; ///< Earlier conflicting systems.
+        std::vector<std::size_t> dependents;   ///< Later conflicting systems.
+    };
+
+    void run_node(JobFence& fence, std::size_t index);
+
+    std::vector<Node> nodes_;
+    JobSystem* jobs_ = nullptr;                     ///< Pool for run(); null is serial.
+    std::vector<std::atomic<std::size_t>> pending_; ///< Unfinished dependencies per system.
+};
+
+} // namespace raven
@@ -1,11 +1,15 @@
 #include "ecs/systems/ai_system.hpp"
 
+#include "core/jobs.hpp"
 #include "ecs/components.hpp"
 #include "ecs/systems/hitbox_math.hpp"
 #include "ecs/systems/player_utils.hpp"
 
+#include <algorithm>
 #include <cmath>
+#include <mutex>
 #include <random>
+#include <vector>
 
 namespace raven::systems {
 
@@ -24,39 +28,6 @@ float normalize(float& x, float& y) {
     return len;
 }
 
-/// @brief Check line-of-sight between two points using the tilemap.
-///
-/// Steps along the line in half-cell increments and checks for solid cells.
-/// @param tilemap The tilemap with collision data.
-/// @param x1 Start X position.
-/// @param y1 Start Y position.
-/// @param x2 End X position.
-/// @param y2 End Y position.
-/// @return True if there is an unobstructed line of sight.
-bool has_line_of_sight(const Tilemap& tilemap, float x1, float y1, float x2, float y2) {
-    if (!tilemap.is_loaded()) {
-        return true;
-    }
-
-    float dx = x2 - x1;
-    float dy = y2 - y1;
-    float dist = normalize(dx, dy);
-
-    float step_size = static_cast<float>(tilemap.cell_size()) * 0.5f;
-    int steps = static_cast<int>(dist / step_size);
-
-    for (int i = 1; i <= steps; ++i) {
-        float px = x1 + dx * step_size * static_cast<float>(i);
-        float py = y1 + dy * step_size * static_cast<float>(i);
-        int gx = static_cast<int>(px) / tilemap.cell_size();
-        int gy = static_cast<int>(py) / tilemap.cell_size();
-        if (tilemap.is_cell_solid(gx, gy)) {
-            return false;
-        }
-    }
-    return true;
-}
-
 /// @brief Update a Chaser enemy: beeline toward the player.
 void update_chaser(Velocity& vel, const AiBehavior& ai, float dir_x, float dir_y) {
     vel.dx = dir_x * ai.move_speed;
@@ -201,6 +172,30 @@ void update_coward(Velocity& vel, AiBehavior& ai, float dir_x, float dir_y, floa
 
 } // anonymous namespace
 
+bool has_line_of_sight(const Tilemap& tilemap, float x1, float y1, float x2, float y2) {
+    if (!tilemap.is_loaded()) {
+        return true;
+    }
+
+    float dx = x2 - x1;
+    float dy = y2 - y1;
+    float dist = normalize(dx, dy);
+
+    float step_size = static_cast<float>(tilemap.cell_size()) * 0.5f;
+    int steps = static_cast<int>(dist / step_size);
+
+    for (int i = 1; i <= steps; ++i) {
+        float px = x1 + dx * step_size * static_cast<float>(i);
+        float py = y1 + dy * step_size * static_cast<float>(i);
+        int gx = static_cast<int>(px) / tilemap.cell_size();
+        int gy = static_cast<int>(py) / tilemap.cell_size();
+        if (tilemap.is_cell_solid(gx, gy)) {
+            return false;
+        }
+    }
+    return true;
+}
+
 void update_ai(entt::registry& reg, const Tilemap& tilemap, float dt) {
     float player_x = 0.f;
     float player_y = 0.f;
@@ -210,17 +205,26 @@ void update_ai(entt::registry& reg, const Tilemap& tilemap, float dt) {
 
     auto* rng = reg.ctx().find<std::mt19937>();
 
-    auto view = reg.view<Transform2D, Velocity, AiBehavior>();
-    for (auto [entity, tf, vel, ai] : view.each()) {
+    // Looked up once: the steering body runs on job threads and must not
+    // create storages. Expired knockbacks are removed after the loop.
+    auto& knockbacks = reg.storage<Knockback>();
+    auto& emitters = reg.storage<BulletEmitter>();
+    const auto& disarmed = reg.storage<Disarmed>();
+    std::mutex expired_mutex;
+    std::vector<entt::entity> expired_knockbacks;
+
+    auto steer = [&](entt::entity entity, const Transform2D& tf, Velocity& vel, AiBehavior& ai) {
         // Knockback overrides AI
-        if (auto* kb = reg.try_get<Knockback>(entity)) {
-            vel.dx = kb->dx;
-            vel.dy = kb->dy;
-            kb->remaining -= dt;
-            if (kb->remaining <= 0.f) {
-                reg.remove<Knockback>(entity);
+        if (knockbacks.contains(entity)) {
+            auto& kb = knockbacks.get(entity);
+            vel.dx = kb.dx;
+            vel.dy = kb.dy;
+            kb.remaining -= dt;
+            if (kb.remaining <= 0.f) {
+                std::lock_guard lock(expired_mutex);
+                expired_knockbacks.push_back(entity);
             }
-            continue;
+            return;
         }
 
         float dx = player_x - tf.x;
@@ -242,10 +246,10 @@ void update_ai(entt::registry& reg, const Tilemap& tilemap, float dt) {
                 vel.dx = 0.f;
                 vel.dy = 0.f;
                 // Emitter off while idle
-                if (auto* emitter = reg.try_get<BulletEmitter>(entity)) {
-                    emitter->active = false;
+                if (emitters.contains(entity)) {
+                    emitters.get(entity).active = false;
                 }
-                continue;
+                return;
             }
             // Activate
             ai.phase = AiBehavior::Phase::Advance;
@@ -270,19 +274,38 @@ void update_ai(entt::registry& reg, const Tilemap& tilemap, float dt) {
         }
 
         // Disarmed enemies become aggressive Chasers
-        if (reg.any_of<Disarmed>(entity)) {
+        if (disarmed.contains(entity)) {
             vel.dx = dir_x * ai.move_speed * 1.5f;
             vel.dy = dir_y * ai.move_speed * 1.5f;
         }
 
         // Toggle emitter based on attack range
-        if (auto* emitter = reg.try_get<BulletEmitter>(entity)) {
+        if (emitters.contains(entity)) {
             bool in_attack_range = dist <= ai.attack_range;
             // Coward always fires; others respect attack_range
-            emitter->active = (ai.archetype == AiBehavior::Archetype::Coward) || in_attack_range;
+            emitters.get(entity).active =
+                (ai.archetype == AiBehavior::Archetype::Coward) || in_attack_range;
+        }
+    };
+
+    // Drifters draw from the shared RNG, so they stay on this thread in view
+    // order to keep the sequence reproducible; everyone else is independent
+    auto view = reg.view<Transform2D, Velocity, AiBehavior>();
+    parallel_each(find_jobs(reg), view, 64,
+                  [&](entt::entity entity, const Transform2D& tf, Velocity& vel, AiBehavior& ai) {
+                      if (ai.archetype != AiBehavior::Archetype::Drifter) {
+                          steer(entity, tf, vel, ai);
+                      }
+                  });
+    for (auto [entity, tf, vel, ai] : view.each()) {
+        if (ai.archetype == AiBehavior::Archetype::Drifter) {
+            steer(entity, tf, vel, ai);
         }
     }
 
+    std::sort(expired_knockbacks.begin(), expired_knockbacks.end());
+    knockbacks.remove(expired_knockbacks.begin(), expired_knockbacks.end());
+
     // Tick all contact damage cooldowns independently
     auto contact_tick_view = reg.view<ContactDamage>();
     for (auto [e_ent, contact] : contact_tick_view.each()) {
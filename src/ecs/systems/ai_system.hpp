@@ -16,4 +16,15 @@ namespace raven::systems {
 /// @param dt Fixed timestep delta in seconds.
 void update_ai(entt::registry& reg, const Tilemap& tilemap, float dt);
 
+/// @brief Check line-of-sight between two points using the tilemap.
+///
+/// Steps along the line in half-cell increments and checks for solid cells.
+/// @param tilemap The tilemap with collision data.
+/// @param x1 Start X position.
+/// @param y1 Start Y position.
+/// @param x2 End X position.
+/// @param y2 End Y position.
+/// @return True if there is an unobstructed line of sight.
+bool has_line_of_sight(const Tilemap& tilemap, float x1, float y1, float x2, float y2);
+
 } // namespace raven::systems
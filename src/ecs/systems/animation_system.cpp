@@ -1,12 +1,74 @@
 #include "ecs/systems/animation_system.hpp"
 
+#include "core/jobs.hpp"
 #include "ecs/components.hpp"
 
 namespace raven::systems {
 
+void update_animation_state(entt::registry& reg) {
+    // Priority: Melee > Dash > Walk > Idle
+    auto anim_view = reg.view<Player, Velocity, Animation, Sprite, AnimationState>();
+    for (auto [entity, player, vel, anim, sprite, state] : anim_view.each()) {
+        AnimationState::State desired;
+        if (reg.any_of<MeleeAttack>(entity) || reg.any_of<GroundSlam>(entity)) {
+            desired = AnimationState::State::Melee;
+        } else if (reg.any_of<Dash>(entity)) {
+            desired = AnimationState::State::Dash;
+        } else if ((vel.dx * vel.dx + vel.dy * vel.dy) > 1.f) {
+            desired = AnimationState::State::Walk;
+        } else {
+            desired = AnimationState::State::Idle;
+        }
+
+        if (state.current != desired) {
+            state.current = desired;
+            switch (desired) {
+            case AnimationState::State::Melee:
+                sprite.frame_y = 1;
+                anim.start_frame = 0;
+                anim.end_frame = 2;
+                anim.frame_duration = 0.05f;
+                anim.looping = false;
+                break;
+            case AnimationState::State::Dash:
+                sprite.frame_y = 1;
+                anim.start_frame = 0;
+                anim.end_frame = 2;
+                anim.frame_duration = 0.04f;
+                anim.looping = false;
+                break;
+            case AnimationState::State::Walk:
+                sprite.frame_y = 1;
+                anim.start_frame = 0;
+                anim.end_frame = 5;
+                anim.frame_duration = 0.1f;
+                anim.looping = true;
+                break;
+            case AnimationState::State::Idle:
+                sprite.frame_y = 0;
+                anim.start_frame = 0;
+                anim.end_frame = 3;
+                anim.frame_duration = 0.25f;
+                anim.looping = true;
+                break;
+            }
+            anim.current_frame = anim.start_frame;
+            anim.elapsed = 0.f;
+        }
+
+        // Flip sprite to face aim direction
+        if (auto* aim = reg.try_get<AimDirection>(entity)) {
+            if (aim->x > 0.f)
+                sprite.flip_x = false;
+            else if (aim->x < 0.f)
+                sprite.flip_x = true;
+        }
+    }
+}
+
 void update_animation(entt::registry& reg, float dt) {
     auto view = reg.view<Animation, Sprite>();
-    for (auto [entity, anim, sprite] : view.each()) {
+    parallel_each(find_jobs(reg), view, 256, [dt](entt::entity, Animation& anim, Sprite& sprite) {
         anim.elapsed += dt;
 
         while (anim.elapsed >= anim.frame_duration) {
@@ -21,7 +83,7 @@ void update_animation(entt::registry& reg, float dt) {
         }
 
         sprite.frame_x = anim.current_frame;
-    }
+    });
 }
 
 } // namespace raven::systems
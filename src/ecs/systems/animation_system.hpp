@@ -4,6 +4,14 @@
 
 namespace raven::systems {
 
+/// @brief Switch player animations to match their current action.
+///
+/// Picks Melee > Dash > Walk > Idle from the player's components and
+/// velocity, rewrites the Animation range when the state changes, and flips
+/// the Sprite to face the AimDirection.
+/// @param reg The ECS registry containing the player.
+void update_animation_state(entt::registry& reg);
+
 /// @brief Advance Animation timers and sync current_frame to Sprite::frame_x.
 /// @param reg The ECS registry containing entities to update.
 /// @param dt Fixed timestep delta in seconds (typically 1/120).
@@ -0,0 +1,86 @@
+#pragma once
+
+#include "core/clock.hpp"
+#include "ecs/components.hpp"
+
+#include <entt/entt.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+
+namespace raven::systems {
+
+/// @brief Position and instantaneous velocity of a BulletMotion at some time.
+struct MotionSample {
+    float x = 0.f;  ///< World X position in pixels.
+    float y = 0.f;  ///< World Y position in pixels.
+    float vx = 0.f; ///< Velocity X in pixels/sec.
+    float vy = 0.f; ///< Velocity Y in pixels/sec.
+};
+
+/// @brief Current SimTick, or 0 when the registry has none (unit tests).
+[[nodiscard]] inline uint64_t current_sim_tick(const entt::registry& reg) {
+    const auto* sim = reg.ctx().find<SimTick>();
+    return sim ? sim->tick : 0;
+}
+
+/// @brief Seconds of travel for a bullet during tick @p tick.
+///
+/// A bullet spawned in tick S has travelled one full step after movement
+/// runs in tick S, so movement evaluates with @p fraction = 1. Rendering
+/// between the last two simulated states uses the interpolation alpha.
+/// @param motion The bullet's motion.
+/// @param tick The current SimTick.
+/// @param fraction Sub-tick offset in [0, 1].
+[[nodiscard]] inline float motion_time(const BulletMotion& motion, uint64_t tick, float fraction) {
+    if (tick < motion.spawn_tick) {
+        return 0.f;
+    }
+    return (static_cast<float>(tick - motion.spawn_tick) + fraction) * Clock::TICK_RATE;
+}
+
+/// @brief Evaluate a BulletMotion in closed form.
+///
+/// Straight motion is origin + (v0 t + a t^2 / 2) * dir. With a turning rate
+/// w the heading is theta0 + w t, and the position is the integral of
+/// (v0 + a t) * e^{i(theta0 + w t)}. The curved branch runs in double
+/// because its 1/w and 1/w^2 terms cancel badly in float for slow turns.
+///
+/// Deceleration brings a bullet to rest instead of reversing it: once the
+/// speed reaches zero, time stops advancing and the bullet stays put.
+/// @param motion The bullet's motion.
+/// @param t Seconds since spawn.
+[[nodiscard]] inline MotionSample evaluate_motion(const BulletMotion& motion, float t) {
+    if (motion.acceleration < 0.f) {
+        t = std::min(t, std::max(0.f, -motion.speed / motion.acceleration));
+    }
+    float speed = std::max(0.f, motion.speed + motion.acceleration * t);
+
+    if (std::abs(motion.angular_velocity) < 1e-6f) {
+        float dist = (motion.speed + 0.5f * motion.acceleration * t) * t;
+        return {motion.origin_x + motion.dir_x * dist, motion.origin_y + motion.dir_y * dist,
+                motion.dir_x * speed, motion.dir_y * speed};
+    }
+
+    const double w = static_cast<double>(motion.angular_velocity);
+    const double td = static_cast<double>(t);
+    const double v0 = static_cast<double>(motion.speed);
+    const double a = static_cast<double>(motion.acceleration);
+    const double c0 = static_cast<double>(motion.dir_x);
+    const double s0 = static_cast<double>(motion.dir_y);
+
+    // Heading at t: rotate the initial heading by w t
+    const double cr = std::cos(w * td);
+    const double sr = std::sin(w * td);
+    const double ct = c0 * cr - s0 * sr;
+    const double st = s0 * cr + c0 * sr;
+
+    const double px = v0 * (st - s0) / w + a * (td * st / w + (ct - c0) / (w * w));
+    const double py = -v0 * (ct - c0) / w + a * (-td * ct / w + (st - s0) / (w * w));
+
+    return {motion.origin_x + static_cast<float>(px), motion.origin_y + static_cast<float>(py),
+            static_cast<float>(ct) * speed, static_cast<float>(st) * speed};
+}
+
+} // namespace raven::systems
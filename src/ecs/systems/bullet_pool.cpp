@@ -0,0 +1,138 @@
+#include "ecs/systems/bullet_pool.hpp"
+
+#include "ecs/systems/bullet_motion.hpp"
+
+#include <algorithm>
+#include <functional>
+#include <utility>
+
+namespace raven::systems {
+
+namespace {
+
+template <typename T>
+void swap_remove(std::vector<T>& values, std::size_t slot) {
+    values[slot] = std::move(values.back());
+    values.pop_back();
+}
+
+} // namespace
+
+void BulletPool::reserve(std::size_t count) {
+    x.reserve(count);
+    y.reserve(count);
+    vx.reserve(count);
+    vy.reserve(count);
+    life.reserve(count);
+    radius.reserve(count);
+    damage.reserve(count);
+    owner.reserve(count);
+    sprite.reserve(count);
+    motion.reserve(count);
+    serial.reserve(count);
+}
+
+void BulletPool::spawn(const BulletSpawnParams& params, uint64_t tick) {
+    x.push_back(params.origin_x);
+    y.push_back(params.origin_y);
+    auto vel = spawn_velocity(params);
+    vx.push_back(vel.dx);
+    vy.push_back(vel.dy);
+    life.push_back(params.lifetime);
+    radius.push_back(params.hitbox_radius);
+    damage.push_back(params.damage);
+    owner.push_back(params.owner);
+    sprite.push_back(
+        {params.sheet_id, params.frame_x, params.frame_y, params.width, params.height});
+    motion.push_back(spawn_motion(params, tick));
+
+    uint32_t id = next_serial++;
+    serial.push_back(id);
+    if (params.piercing) {
+        piercing.emplace(id, std::vector<entt::entity>{});
+    }
+}
+
+void BulletPool::remove(std::size_t slot) {
+    if (!piercing.empty()) {
+        piercing.erase(serial[slot]);
+    }
+
+    swap_remove(x, slot);
+    swap_remove(y, slot);
+    swap_remove(vx, slot);
+    swap_remove(vy, slot);
+    swap_remove(life, slot);
+    swap_remove(radius, slot);
+    swap_remove(damage, slot);
+    swap_remove(owner, slot);
+    swap_remove(sprite, slot);
+    swap_remove(motion, slot);
+    swap_remove(serial, slot);
+}
+
+void BulletPool::remove_all(std::vector<std::size_t>& slots) {
+    // Highest slot first: the bullet swapped in from the back is always a
+    // survivor, so the remaining (lower) slots stay valid
+    std::sort(slots.begin(), slots.end(), std::greater<>{});
+    slots.erase(std::unique(slots.begin(), slots.end()), slots.end());
+    for (auto slot : slots) {
+        remove(slot);
+    }
+}
+
+void BulletPool::clear() {
+    x.clear();
+    y.clear();
+    vx.clear();
+    vy.clear();
+    life.clear();
+    radius.clear();
+    damage.clear();
+    owner.clear();
+    sprite.clear();
+    motion.clear();
+    serial.clear();
+    piercing.clear();
+}
+
+std::vector<entt::entity>* BulletPool::piercing_hits(std::size_t slot) {
+    if (piercing.empty()) {
+        return nullptr;
+    }
+    auto it = piercing.find(serial[slot]);
+    return it != piercing.end() ? &it->second : nullptr;
+}
+
+void advance_bullet_pool(BulletPool& pool, uint64_t tick, JobSystem* jobs) {
+    // Slots are independent: each chunk writes only its own indices
+    parallel_for(jobs, pool.size(), 512, [&pool, tick](std::size_t begin, std::size_t end) {
+        for (std::size_t i = begin; i < end; ++i) {
+            auto sample = evaluate_motion(pool.motion[i], motion_time(pool.motion[i], tick, 1.f));
+            pool.x[i] = sample.x;
+            pool.y[i] = sample.y;
+            pool.vx[i] = sample.vx;
+            pool.vy[i] = sample.vy;
+        }
+    });
+}
+
+void cleanup_bullet_pool(BulletPool& pool, float dt, int screen_w, int screen_h, float view_x,
+                         float view_y) {
+    constexpr float MARGIN = 32.f;
+    const float min_x = view_x - MARGIN;
+    const float min_y = view_y - MARGIN;
+    const float max_x = view_x + static_cast<float>(screen_w) + MARGIN;
+    const float max_y = view_y + static_cast<float>(screen_h) + MARGIN;
+
+    // Walk backwards so swap-remove only moves already-visited bullets
+    for (std::size_t i = pool.size(); i-- > 0;) {
+        pool.life[i] -= dt;
+        if (pool.life[i] <= 0.f || pool.x[i] < min_x || pool.x[i] > max_x || pool.y[i] < min_y ||
+            pool.y[i] > max_y) {
+            pool.remove(i);
+        }
+    }
+}
+
+} // namespace raven::systems
@@ -0,0 +1,105 @@
+#pragma once
+
+#include "core/jobs.hpp"
+#include "core/string_id.hpp"
+#include "ecs/components.hpp"
+#include "ecs/systems/bullet_spawn.hpp"
+
+#include <entt/entt.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <unordered_map>
+#include <vector>
+
+namespace raven::systems {
+
+/// @brief Sprite frame shared by a pooled bullet (always drawn on layer 5).
+struct PooledSprite {
+    StringId sheet_id; ///< Interned sprite sheet identifier.
+    int frame_x = 1;   ///< Frame column in the sheet.
+    int frame_y = 0;   ///< Frame row in the sheet.
+    int width = 8;     ///< Pixel width of the frame.
+    int height = 8;    ///< Pixel height of the frame.
+};
+
+/// @brief Registry-context structure-of-arrays store for bullets.
+///
+/// When present, spawn_bullet() writes here instead of creating a registry
+/// entity with nine components. Every per-bullet field lives in its own
+/// contiguous array indexed by slot; removal swaps the last bullet into the
+/// hole, so slots are not stable across removals. Movement, collision,
+/// cleanup and rendering each walk the arrays directly.
+///
+/// Every pooled bullet moves in closed form from its BulletMotion, whether
+/// or not it was spawned as analytic (straight bullets are the w = a = 0
+/// case). Position is never integrated and no previous-tick copy is kept:
+/// the renderer evaluates the motion at t + alpha.
+///
+/// Piercing bullets keep their already-hit enemy lists in a side table
+/// keyed by a stable serial number, so the common non-piercing bullet pays
+/// nothing for it.
+struct BulletPool {
+    std::vector<float> x;             ///< World X position in pixels.
+    std::vector<float> y;             ///< World Y position in pixels.
+    std::vector<float> vx;            ///< Current velocity X in pixels/sec (derived).
+    std::vector<float> vy;            ///< Current velocity Y in pixels/sec (derived).
+    std::vector<float> life;          ///< Seconds until expiry.
+    std::vector<float> radius;        ///< Circle hitbox radius in pixels.
+    std::vector<float> damage;        ///< Damage on contact.
+    std::vector<Bullet::Owner> owner; ///< Who fired the bullet.
+    std::vector<PooledSprite> sprite; ///< Sprite frame.
+    std::vector<uint32_t> serial;     ///< Stable id (piercing side-table key).
+    std::vector<BulletMotion> motion; ///< Closed-form trajectory.
+
+    /// @brief Hit lists for piercing bullets, keyed by serial.
+    std::unordered_map<uint32_t, std::vector<entt::entity>> piercing;
+
+    uint32_t next_serial = 0; ///< Serial handed to the next spawned bullet.
+
+    /// @brief Number of live bullets.
+    [[nodiscard]] std::size_t size() const { return x.size(); }
+
+    /// @brief Pre-allocate every array for a bullet count.
+    void reserve(std::size_t count);
+
+    /// @brief Append a bullet.
+    /// @param params Bullet configuration (same as for entity bullets).
+    /// @param tick SimTick the bullet spawns in (its motion's time zero).
+    void spawn(const BulletSpawnParams& params, uint64_t tick = 0);
+
+    /// @brief Swap-remove the bullet in a slot.
+    /// @param slot Index in [0, size()). The last bullet moves into it.
+    void remove(std::size_t slot);
+
+    /// @brief Remove several slots at once.
+    /// @param slots Slots to remove; sorted and deduplicated in place.
+    void remove_all(std::vector<std::size_t>& slots);
+
+    /// @brief Remove every bullet.
+    void clear();
+
+    /// @brief Piercing hit list for a slot.
+    /// @return The list, or nullptr if the bullet is not piercing.
+    [[nodiscard]] std::vector<entt::entity>* piercing_hits(std::size_t slot);
+};
+
+/// @brief Move every pooled bullet to its closed-form position after a tick.
+/// @param pool The bullet pool.
+/// @param tick The SimTick being simulated.
+/// @param jobs Job system to split the slots over, or null to run inline.
+void advance_bullet_pool(BulletPool& pool, uint64_t tick, JobSystem* jobs = nullptr);
+
+/// @brief Tick lifetimes and remove expired or off-screen pooled bullets.
+///
+/// Uses the same 32px off-screen margin as update_cleanup().
+/// @param pool The bullet pool.
+/// @param dt Fixed timestep delta in seconds.
+/// @param screen_w Screen width in pixels.
+/// @param screen_h Screen height in pixels.
+/// @param view_x Left edge of the view in world pixels (Camera::x).
+/// @param view_y Top edge of the view in world pixels (Camera::y).
+void cleanup_bullet_pool(BulletPool& pool, float dt, int screen_w, int screen_h,
+                         float view_x = 0.f, float view_y = 0.f);
+
+} // namespace raven::systems
@@ -1,21 +1,27 @@
 #include "ecs/systems/bullet_spawn.hpp"
 
 #include "ecs/components.hpp"
-
-#include <cmath>
+#include "ecs/systems/bullet_motion.hpp"
+#include "ecs/systems/bullet_pool.hpp"
 
 namespace raven::systems {
 
 entt::entity spawn_bullet(entt::registry& reg, const BulletSpawnParams& params) {
-    auto entity = reg.create();
+    uint64_t tick = current_sim_tick(reg);
+    if (auto* pool = reg.ctx().find<BulletPool>()) {
+        pool->spawn(params, tick);
+        return entt::null;
+    }
 
-    float rotation = params.angle_rad;
-    float vx = std::cos(rotation) * params.speed;
-    float vy = std::sin(rotation) * params.speed;
+    auto entity = reg.create();
 
-    reg.emplace<Transform2D>(entity, params.origin_x, params.origin_y, rotation);
-    reg.emplace<PreviousTransform>(entity, params.origin_x, params.origin_y);
-    reg.emplace<Velocity>(entity, vx, vy);
+    reg.emplace<Transform2D>(entity, params.origin_x, params.origin_y, params.angle_rad);
+    if (params.analytic) {
+        reg.emplace<BulletMotion>(entity, spawn_motion(params, tick));
+    } else {
+        reg.emplace<PreviousTransform>(entity, params.origin_x, params.origin_y);
+    }
+    reg.emplace<Velocity>(entity, spawn_velocity(params));
     reg.emplace<Bullet>(entity, params.owner);
     reg.emplace<DamageOnContact>(entity, params.damage);
     reg.emplace<Lifetime>(entity, params.lifetime);
@@ -31,4 +37,23 @@ entt::entity spawn_bullet(entt::registry& reg, const BulletSpawnParams& params)
     return entity;
 }
 
+void spawn_bullets(entt::registry& reg, std::span<const BulletSpawnParams> bullets) {
+    if (bullets.empty()) {
+        return;
+    }
+
+    uint64_t tick = current_sim_tick(reg);
+    if (auto* pool = reg.ctx().find<BulletPool>()) {
+        for (const auto& params : bullets) {
+            pool->spawn(params, tick);
+        }
+        return;
+    }
+
+    // Registry bullets only exist without a pool (tests, tools): no batching
+    for (const auto& params : bullets) {
+        spawn_bullet(reg, params);
+    }
+}
+
 } // namespace raven::systems
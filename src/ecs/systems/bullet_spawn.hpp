@@ -4,6 +4,11 @@
 
 #include <entt/entt.hpp>
 
+#include <cmath>
+#include <cstdint>
+#include <span>
+#include <vector>
+
 namespace raven::systems {
 
 /// @brief Parameters for spawning a single bullet entity.
@@ -11,6 +16,9 @@ struct BulletSpawnParams {
     float origin_x = 0.f;                        ///< Spawn X position in pixels.
     float origin_y = 0.f;                        ///< Spawn Y position in pixels.
     float angle_rad = 0.f;                       ///< Travel direction in radians.
+    float dir_x = 0.f;                           ///< Unit travel direction X (if has_dir).
+    float dir_y = 0.f;                           ///< Unit travel direction Y (if has_dir).
+    bool has_dir = false;                        ///< Use dir_x/dir_y instead of cos/sin.
     float speed = 300.f;                         ///< Speed in pixels/sec.
     float damage = 1.f;                          ///< Damage on contact.
     float lifetime = 3.f;                        ///< Lifetime in seconds.
@@ -22,12 +30,63 @@ struct BulletSpawnParams {
     int width = 8;                               ///< Pixel width of bullet frame.
     int height = 8;                              ///< Pixel height of bullet frame.
     bool piercing = false;                       ///< Whether the bullet passes through targets.
+    bool analytic = false;                       ///< Closed-form BulletMotion, no integration.
+    float angular_velocity = 0.f;                ///< Heading change in radians/sec.
+    float acceleration = 0.f;                    ///< Speed change in pixels/sec^2.
+};
+
+/// @brief Registry-context buffer a system fills with a burst before spawn_bullets().
+///
+/// Cleared per burst; the capacity stays allocated. A named type so it
+/// cannot collide with other vectors in the ctx and so schedules can
+/// declare it as scratch.
+struct BulletSpawnScratch {
+    std::vector<BulletSpawnParams> params; ///< Bullets of the burst being built.
 };
 
+/// @brief Initial velocity of a bullet, skipping trig when a direction is supplied.
+/// @param params Bullet configuration.
+/// @return Velocity along dir_x/dir_y (or angle_rad) scaled by speed.
+[[nodiscard]] inline Velocity spawn_velocity(const BulletSpawnParams& params) {
+    if (params.has_dir) {
+        return {params.dir_x * params.speed, params.dir_y * params.speed};
+    }
+    return {std::cos(params.angle_rad) * params.speed, std::sin(params.angle_rad) * params.speed};
+}
+
+/// @brief Closed-form motion for a bullet spawned during a given tick.
+/// @param params Bullet configuration.
+/// @param tick Current SimTick.
+[[nodiscard]] inline BulletMotion spawn_motion(const BulletSpawnParams& params, uint64_t tick) {
+    float dx = params.has_dir ? params.dir_x : std::cos(params.angle_rad);
+    float dy = params.has_dir ? params.dir_y : std::sin(params.angle_rad);
+    return {tick,
+            params.origin_x,
+            params.origin_y,
+            dx,
+            dy,
+            params.speed,
+            params.angular_velocity,
+            params.acceleration};
+}
+
 /// @brief Create a bullet entity with all required components.
+///
+/// Analytic bullets get a BulletMotion instead of a PreviousTransform and
+/// are moved in closed form. If a BulletPool exists in the registry ctx the
+/// bullet is appended to the pool instead and no entity is created.
 /// @param reg The ECS registry.
 /// @param params Bullet configuration.
-/// @return The newly created bullet entity.
+/// @return The newly created bullet entity, or entt::null for a pooled bullet.
 entt::entity spawn_bullet(entt::registry& reg, const BulletSpawnParams& params);
 
+/// @brief Create a batch of bullets in one go (e.g. an emitter burst).
+///
+/// Appends the whole burst to the BulletPool when present, reading the
+/// SimTick once. Without a pool this is equivalent to calling
+/// spawn_bullet() for each element.
+/// @param reg The ECS registry.
+/// @param bullets Bullet configurations, spawned in order.
+void spawn_bullets(entt::registry& reg, std::span<const BulletSpawnParams> bullets);
+
 } // namespace raven::systems
@@ -0,0 +1,42 @@
+#include "ecs/systems/camera_system.hpp"
+
+#include "ecs/components.hpp"
+#include "rendering/renderer.hpp"
+
+#include <algorithm>
+
+namespace raven::systems {
+
+void configure_camera(entt::registry& reg, float world_w, float world_h) {
+    auto& camera = reg.ctx().insert_or_assign(Camera{});
+    camera.width = static_cast<float>(Renderer::VIRTUAL_WIDTH);
+    camera.height = static_cast<float>(Renderer::VIRTUAL_HEIGHT);
+    camera.world_w = world_w;
+    camera.world_h = world_h;
+
+    update_camera(reg);
+    camera.prev_x = camera.x;
+    camera.prev_y = camera.y;
+}
+
+void update_camera(entt::registry& reg) {
+    auto* camera = reg.ctx().find<Camera>();
+    if (!camera) {
+        return;
+    }
+    camera->prev_x = camera->x;
+    camera->prev_y = camera->y;
+
+    auto players = reg.view<Transform2D, Player>();
+    if (players.begin() == players.end()) {
+        return;
+    }
+    const auto& tf = players.get<Transform2D>(*players.begin());
+
+    const float max_x = std::max(camera->world_w - camera->width, 0.f);
+    const float max_y = std::max(camera->world_h - camera->height, 0.f);
+    camera->x = std::clamp(tf.x - camera->width / 2.f, 0.f, max_x);
+    camera->y = std::clamp(tf.y - camera->height / 2.f, 0.f, max_y);
+}
+
+} // namespace raven::systems
@@ -0,0 +1,25 @@
+#pragma once
+
+#include <entt/entt.hpp>
+
+namespace raven::systems {
+
+/// @brief Set the level size and snap the Camera onto the player.
+///
+/// Creates the Camera in the registry ctx if needed, sized to the virtual
+/// screen. Snapping (prev = current) keeps a room change from sliding the
+/// view across the new level.
+/// @param reg The ECS registry (the Camera lives in its context).
+/// @param world_w Level width in pixels.
+/// @param world_h Level height in pixels.
+void configure_camera(entt::registry& reg, float world_w, float world_h);
+
+/// @brief Centre the Camera on the player, clamped to the level.
+///
+/// Stores the previous position first for render interpolation. Levels
+/// smaller than the view are pinned to the top-left corner. Does nothing
+/// without a Camera in the registry ctx.
+/// @param reg The ECS registry.
+void update_camera(entt::registry& reg);
+
+} // namespace raven::systems
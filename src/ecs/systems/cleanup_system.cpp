@@ -1,42 +1,56 @@
 #include "ecs/systems/cleanup_system.hpp"
 
+#include "core/jobs.hpp"
+#include "ecs/command_buffer.hpp"
 #include "ecs/components.hpp"
+#include "ecs/expiry_timers.hpp"
+#include "ecs/systems/bullet_pool.hpp"
 
-#include <vector>
+#include <mutex>
 
 namespace raven::systems {
 
 void update_cleanup(entt::registry& reg, float dt, int screen_w, int screen_h) {
-    // Tick down lifetimes
-    auto tick_view = reg.view<Lifetime>();
-    for (auto [entity, life] : tick_view.each()) {
-        life.remaining -= dt;
+    DeferredCommands cmds(reg);
+
+    if (auto* timers = reg.ctx().find<ExpiryTimers>()) {
+        // Deadline mode: only the timers due this tick are visited
+        advance_expiry_timers(reg, *timers, *cmds);
+    } else {
+        // Tick down lifetimes and remove entities past them. Flush sorts the
+        // destroys, so the order chunks append in does not matter.
+        std::mutex destroy_mutex;
+        auto& lifetimes = reg.storage<Lifetime>();
+        parallel_each(find_jobs(reg), lifetimes, 256, [&](entt::entity entity, Lifetime& life) {
+            life.remaining -= dt;
+            if (life.remaining <= 0.f) {
+                std::lock_guard lock(destroy_mutex);
+                cmds->destroy(entity);
+            }
+        });
     }
 
-    std::vector<entt::entity> to_destroy;
-
-    // Remove entities past their lifetime
-    auto lifetime_view = reg.view<Lifetime>();
-    for (auto [entity, life] : lifetime_view.each()) {
-        if (life.remaining <= 0.f) {
-            to_destroy.push_back(entity);
-        }
+    // Remove entities tagged for despawn once they leave the camera's view
+    float view_x = 0.f;
+    float view_y = 0.f;
+    if (const auto* camera = reg.ctx().find<Camera>()) {
+        view_x = camera->x;
+        view_y = camera->y;
     }
-
-    // Remove off-screen entities tagged for despawn
     constexpr float MARGIN = 32.f;
+    const float min_x = view_x - MARGIN;
+    const float min_y = view_y - MARGIN;
+    const float max_x = view_x + static_cast<float>(screen_w) + MARGIN;
+    const float max_y = view_y + static_cast<float>(screen_h) + MARGIN;
     auto offscreen_view = reg.view<Transform2D, OffScreenDespawn>();
     for (auto [entity, tf] : offscreen_view.each()) {
-        if (tf.x < -MARGIN || tf.x > static_cast<float>(screen_w) + MARGIN || tf.y < -MARGIN ||
-            tf.y > static_cast<float>(screen_h) + MARGIN) {
-            to_destroy.push_back(entity);
+        if (tf.x < min_x || tf.x > max_x || tf.y < min_y || tf.y > max_y) {
+            cmds->destroy(entity);
         }
     }
 
-    for (auto entity : to_destroy) {
-        if (reg.valid(entity)) {
-            reg.destroy(entity);
-        }
+    if (auto* pool = reg.ctx().find<BulletPool>()) {
+        cleanup_bullet_pool(*pool, dt, screen_w, screen_h, view_x, view_y);
     }
 }
 
@@ -5,6 +5,11 @@
 namespace raven::systems {
 
 /// @brief Tick entity lifetimes and destroy expired or off-screen entities.
+///
+/// With ExpiryTimers in the registry ctx, Lifetime and Invulnerable expire
+/// from the timer wheel instead of per-entity countdowns. Pooled bullets
+/// (BulletPool in the registry ctx) keep their fused lifetime/bounds pass.
+/// Off-screen is measured from the Camera in the registry ctx, if any.
 /// @param reg The ECS registry containing entities to check.
 /// @param dt Fixed timestep delta in seconds (typically 1/120).
 /// @param screen_w Virtual screen width in pixels (Renderer::VIRTUAL_WIDTH).
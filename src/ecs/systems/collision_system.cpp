@@ -1,6 +1,9 @@
 #include "ecs/systems/collision_system.hpp"
 
+#include "ecs/command_buffer.hpp"
 #include "ecs/components.hpp"
+#include "ecs/systems/bullet_pool.hpp"
+#include "ecs/systems/damage_system.hpp"
 #include "ecs/systems/hitbox_math.hpp"
 
 #include <algorithm>
@@ -9,95 +12,274 @@
 
 namespace raven::systems {
 
-void update_collision(entt::registry& reg) {
-    // Player vs enemy bullets
-    auto players = reg.view<Transform2D, CircleHitbox, Player, Health>();
-    auto enemy_bullets = reg.view<Transform2D, CircleHitbox, Bullet, DamageOnContact>();
+namespace {
 
-    // Collect bullets to destroy after iteration (avoid invalidating views)
-    std::vector<entt::entity> enemy_bullets_to_destroy;
+constexpr float DEFAULT_BOUNDS_W = 480.f; ///< Virtual screen width (Renderer::VIRTUAL_WIDTH).
+constexpr float DEFAULT_BOUNDS_H = 270.f; ///< Virtual screen height (Renderer::VIRTUAL_HEIGHT).
 
-    for (auto [p_ent, p_tf, p_hb, player, p_hp] : players.each()) {
-        // Skip if invulnerable
-        if (auto* inv = reg.try_get<Invulnerable>(p_ent)) {
-            if (inv->remaining > 0.f)
-                continue;
+/// @brief Fetch the broad-phase from the registry ctx, creating it on first use.
+CollisionBroadPhase& broad_phase(entt::registry& reg) {
+    auto& bp = reg.ctx().emplace<CollisionBroadPhase>();
+    if (!bp.enemies.configured()) {
+        bp.enemies.reset(DEFAULT_BOUNDS_W, DEFAULT_BOUNDS_H);
+        bp.enemy_bullets.reset(DEFAULT_BOUNDS_W, DEFAULT_BOUNDS_H);
+    }
+    return bp;
+}
+
+/// @brief Append a contact, recording the bullet's travel direction for knockback.
+void push_contact(const entt::registry& reg, ContactBuffer& out, entt::entity bullet,
+                  entt::entity target, Contact::Kind kind, float damage) {
+    Contact contact{bullet, target, kind, 0.f, 0.f, damage};
+    if (const auto* vel = reg.try_get<Velocity>(bullet)) {
+        float len = std::sqrt(vel->dx * vel->dx + vel->dy * vel->dy);
+        if (len > 0.f) {
+            contact.nx = vel->dx / len;
+            contact.ny = vel->dy / len;
         }
+    }
+    out.contacts.push_back(contact);
+}
 
-        for (auto [b_ent, b_tf, b_hb, bullet, dmg] : enemy_bullets.each()) {
-            if (bullet.owner != Bullet::Owner::Enemy)
-                continue;
+/// @brief Narrow-phase the current candidates against one circle.
+///
+/// Gathers the candidates' circles into SoA and runs the batch kernel,
+/// leaving the overlapping item ids in bp.hits in candidate (view) order.
+void narrow_phase(CollisionBroadPhase& bp, const std::vector<BroadPhaseEntry>& items, float x,
+                  float y, float radius) {
+    bp.hits.clear();
+    bp.candidate_circles.clear();
+    for (uint32_t id : bp.candidates) {
+        const auto& item = items[id];
+        bp.candidate_circles.push(item.x, item.y, item.radius);
+    }
 
-            if (circles_overlap(p_tf.x + p_hb.offset_x, p_tf.y + p_hb.offset_y, p_hb.radius,
-                                b_tf.x + b_hb.offset_x, b_tf.y + b_hb.offset_y, b_hb.radius)) {
-                p_hp.current -= dmg.damage;
-                enemy_bullets_to_destroy.push_back(b_ent);
-                push_sfx(reg, Sfx::PlayerHit);
+    for_each_hit(bp.candidate_circles, x, y, radius,
+                 [&bp](std::size_t i) { bp.hits.push_back(bp.candidates[i]); });
+}
+
+/// @brief Append a contact for a pooled bullet (no entity; source is null).
+void push_pool_contact(const BulletPool& pool, ContactBuffer& out, std::size_t slot,
+                       entt::entity target, Contact::Kind kind) {
+    Contact contact{entt::null, target, kind, 0.f, 0.f, pool.damage[slot]};
+    float vx = pool.vx[slot];
+    float vy = pool.vy[slot];
+    float len = std::sqrt(vx * vx + vy * vy);
+    if (len > 0.f) {
+        contact.nx = vx / len;
+        contact.ny = vy / len;
+    }
+    out.contacts.push_back(contact);
+}
 
-                // Grant invulnerability frames
-                reg.emplace_or_replace<Invulnerable>(p_ent, 2.f);
-                break; // one hit per frame
+/// @brief Test pooled player bullets against the enemy grid.
+///
+/// Piercing hit lists live in the pool's side table; new hits are queued in
+/// bp.pool_pierces and consumed slots in bp.pool_kills.
+void collide_pool_player_bullets(BulletPool& pool, CollisionBroadPhase& bp, ContactBuffer& out) {
+    for (std::size_t slot = 0; slot < pool.size(); ++slot) {
+        if (pool.owner[slot] != Bullet::Owner::Player)
+            continue;
+
+        bp.enemies.query(pool.x[slot], pool.y[slot], pool.radius[slot], bp.candidates);
+        if (bp.candidates.empty())
+            continue;
+        narrow_phase(bp, bp.enemy_items, pool.x[slot], pool.y[slot], pool.radius[slot]);
+
+        auto* hit_list = pool.piercing_hits(slot);
+        for (uint32_t id : bp.hits) {
+            const auto& e = bp.enemy_items[id];
+            if (!hit_list) {
+                push_pool_contact(pool, out, slot, e.entity, Contact::Kind::EnemyHit);
+                bp.pool_kills.push_back(slot);
+                break; // non-piercing: one hit then destroy
+            }
+
+            if (std::find(hit_list->begin(), hit_list->end(), e.entity) == hit_list->end()) {
+                push_pool_contact(pool, out, slot, e.entity, Contact::Kind::EnemyHit);
+                bp.pool_pierces.emplace_back(slot, e.entity);
             }
         }
     }
+}
 
-    for (auto b_ent : enemy_bullets_to_destroy) {
-        if (reg.valid(b_ent)) {
-            reg.destroy(b_ent);
+} // namespace
+
+void configure_collision_bounds(entt::registry& reg, float width, float height) {
+    auto& bp = reg.ctx().emplace<CollisionBroadPhase>();
+    bp.enemies.reset(width, height);
+    bp.enemy_bullets.reset(width, height);
+}
+
+void detect_collisions(entt::registry& reg, ContactBuffer& out) {
+    auto& bp = broad_phase(reg);
+    auto* pool = reg.ctx().find<BulletPool>();
+    out.contacts.clear();
+    bp.pool_kills.clear();
+    bp.pool_pierces.clear();
+
+    auto bullets = reg.view<Transform2D, CircleHitbox, Bullet, DamageOnContact>();
+
+    // Broad-phase: bucket bullets by owner and enemies by cell, ids in view order
+    bp.enemy_bullets.clear();
+    bp.bullet_items.clear();
+    bp.player_bullet_items.clear();
+    for (auto [b_ent, b_tf, b_hb, bullet, dmg] : bullets.each()) {
+        BroadPhaseEntry entry{b_ent, b_tf.x + b_hb.offset_x, b_tf.y + b_hb.offset_y, b_hb.radius};
+        if (bullet.owner == Bullet::Owner::Enemy) {
+            auto id = static_cast<uint32_t>(bp.bullet_items.size());
+            bp.bullet_items.push_back(entry);
+            bp.enemy_bullets.insert(id, entry.x, entry.y, entry.radius);
+        } else {
+            bp.player_bullet_items.push_back(entry);
+        }
+    }
+
+    // Pooled enemy bullets follow, so a registry bullet still wins a tie
+    bp.pool_begin = static_cast<uint32_t>(bp.bullet_items.size());
+    bp.pool_slots.clear();
+    if (pool) {
+        for (std::size_t slot = 0; slot < pool->size(); ++slot) {
+            if (pool->owner[slot] != Bullet::Owner::Enemy)
+                continue;
+            auto id = static_cast<uint32_t>(bp.bullet_items.size());
+            BroadPhaseEntry entry{entt::null, pool->x[slot], pool->y[slot], pool->radius[slot]};
+            bp.bullet_items.push_back(entry);
+            bp.pool_slots.push_back(slot);
+            bp.enemy_bullets.insert(id, entry.x, entry.y, entry.radius);
         }
     }
 
-    // Player bullets vs enemies
-    auto player_bullets = reg.view<Transform2D, CircleHitbox, Bullet, DamageOnContact>();
     auto enemies = reg.view<Transform2D, CircleHitbox, Enemy, Health>();
+    bp.enemies.clear();
+    bp.enemy_items.clear();
+    for (auto [e_ent, e_tf, e_hb, enemy, e_hp] : enemies.each()) {
+        auto id = static_cast<uint32_t>(bp.enemy_items.size());
+        BroadPhaseEntry entry{e_ent, e_tf.x + e_hb.offset_x, e_tf.y + e_hb.offset_y, e_hb.radius};
+        bp.enemy_items.push_back(entry);
+        bp.enemies.insert(id, entry.x, entry.y, entry.radius);
+    }
+
+    // Player vs enemy bullets: first overlapping bullet only (one hit per frame)
+    auto players = reg.view<Transform2D, CircleHitbox, Player, Health>();
+    for (auto [p_ent, p_tf, p_hb, player, p_hp] : players.each()) {
+        // Skip if invulnerable
+        if (auto* inv = reg.try_get<Invulnerable>(p_ent)) {
+            if (inv->remaining > 0.f)
+                continue;
+        }
 
-    // Collect bullets to destroy after iteration (avoid invalidating views)
-    std::vector<entt::entity> bullets_to_destroy;
+        float px = p_tf.x + p_hb.offset_x;
+        float py = p_tf.y + p_hb.offset_y;
+        bp.enemy_bullets.query(px, py, p_hb.radius, bp.candidates);
+        narrow_phase(bp, bp.bullet_items, px, py, p_hb.radius);
 
-    for (auto [b_ent, b_tf, b_hb, bullet, dmg] : player_bullets.each()) {
-        if (bullet.owner != Bullet::Owner::Player)
+        if (bp.hits.empty())
             continue;
+        uint32_t id = bp.hits.front();
+        if (id < bp.pool_begin) {
+            const auto& b = bp.bullet_items[id];
+            push_contact(reg, out, b.entity, p_ent, Contact::Kind::PlayerHit,
+                         bullets.get<DamageOnContact>(b.entity).damage);
+        } else {
+            auto slot = bp.pool_slots[id - bp.pool_begin];
+            push_pool_contact(*pool, out, slot, p_ent, Contact::Kind::PlayerHit);
+            bp.pool_kills.push_back(slot);
+        }
+    }
+
+    // Player bullets vs enemies
+    for (const auto& b : bp.player_bullet_items) {
+        const auto* piercing = reg.try_get<Piercing>(b.entity);
+        float damage = bullets.get<DamageOnContact>(b.entity).damage;
+        bp.enemies.query(b.x, b.y, b.radius, bp.candidates);
+        narrow_phase(bp, bp.enemy_items, b.x, b.y, b.radius);
 
-        auto* piercing = reg.try_get<Piercing>(b_ent);
+        for (uint32_t id : bp.hits) {
+            const auto& e = bp.enemy_items[id];
+            if (!piercing) {
+                push_contact(reg, out, b.entity, e.entity, Contact::Kind::EnemyHit, damage);
+                break; // non-piercing: one hit then destroy
+            }
 
-        for (auto [e_ent, e_tf, e_hb, enemy, e_hp] : enemies.each()) {
             // Piercing bullets damage each target once, then pass through
-            if (piercing && std::find(piercing->hit.begin(), piercing->hit.end(), e_ent) !=
-                                piercing->hit.end()) {
-                continue;
+            if (std::find(piercing->hit.begin(), piercing->hit.end(), e.entity) ==
+                piercing->hit.end()) {
+                push_contact(reg, out, b.entity, e.entity, Contact::Kind::EnemyHit, damage);
             }
+        }
+    }
 
-            if (circles_overlap(b_tf.x + b_hb.offset_x, b_tf.y + b_hb.offset_y, b_hb.radius,
-                                e_tf.x + e_hb.offset_x, e_tf.y + e_hb.offset_y, e_hb.radius)) {
-                e_hp.current -= dmg.damage;
-                push_sfx(reg, Sfx::EnemyHit);
-
-                // Apply knockback from bullet impact
-                if (const auto* b_vel = reg.try_get<Velocity>(b_ent)) {
-                    float bvx = b_vel->dx;
-                    float bvy = b_vel->dy;
-                    float len = std::sqrt(bvx * bvx + bvy * bvy);
-                    if (len > 0.f) {
-                        reg.emplace_or_replace<Knockback>(e_ent, bvx / len * 150.f,
-                                                          bvy / len * 150.f, 0.1f);
-                    }
-                }
-
-                if (piercing) {
-                    piercing->hit.push_back(e_ent);
-                } else {
-                    bullets_to_destroy.push_back(b_ent);
-                    break; // non-piercing: one hit then destroy
-                }
+    if (pool) {
+        collide_pool_player_bullets(*pool, bp, out);
+    }
+}
+
+void resolve_contacts(entt::registry& reg, const ContactBuffer& buffer) {
+    const auto& contacts = buffer.contacts;
+    if (contacts.empty())
+        return;
+
+    apply_contact_damage(reg, contacts);
+
+    // Knockback from bullet impact (last hit on an enemy wins)
+    for (const auto& c : contacts) {
+        if (c.kind == Contact::Kind::EnemyHit && (c.nx != 0.f || c.ny != 0.f)) {
+            reg.emplace_or_replace<Knockback>(c.target, c.nx * 150.f, c.ny * 150.f, 0.1f);
+        }
+    }
+
+    // Piercing bookkeeping; everything else that hit is consumed
+    DeferredCommands cmds(reg);
+    bool player_hit = false;
+    bool enemy_hit = false;
+    for (const auto& c : contacts) {
+        if (c.kind == Contact::Kind::PlayerHit) {
+            player_hit = true;
+        } else {
+            enemy_hit = true;
+        }
+
+        // Pooled bullets are consumed below, from the broad-phase queues
+        if (c.source == entt::null)
+            continue;
+
+        if (c.kind == Contact::Kind::PlayerHit) {
+            cmds->destroy(c.source);
+        } else {
+            if (auto* piercing = reg.try_get<Piercing>(c.source)) {
+                piercing->hit.push_back(c.target);
+            } else {
+                cmds->destroy(c.source);
             }
         }
     }
 
-    for (auto b_ent : bullets_to_destroy) {
-        if (reg.valid(b_ent)) {
-            reg.destroy(b_ent);
+    // Record piercing hits before removal moves slots around
+    auto* pool = reg.ctx().find<BulletPool>();
+    auto* bp = reg.ctx().find<CollisionBroadPhase>();
+    if (pool && bp) {
+        for (auto [slot, enemy] : bp->pool_pierces) {
+            if (auto* hit_list = pool->piercing_hits(slot)) {
+                hit_list->push_back(enemy);
+            }
         }
+        bp->pool_pierces.clear();
+        pool->remove_all(bp->pool_kills);
+        bp->pool_kills.clear();
     }
+
+    // One sound per kind per tick, however many bullets connected
+    if (player_hit)
+        push_sfx(reg, Sfx::PlayerHit);
+    if (enemy_hit)
+        push_sfx(reg, Sfx::EnemyHit);
+}
+
+void update_collision(entt::registry& reg) {
+    auto& contacts = reg.ctx().emplace<ContactBuffer>();
+    detect_collisions(reg, contacts);
+    resolve_contacts(reg, contacts);
 }
 
 } // namespace raven::systems
@@ -1,14 +1,86 @@
 #pragma once
 
+#include "ecs/components.hpp"
+#include "ecs/systems/hitbox_math.hpp"
+#include "ecs/systems/spatial_grid.hpp"
+
 #include <entt/entt.hpp>
 
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+#include <vector>
+
 namespace raven::systems {
 
+/// @brief One circle collected for the broad-phase (view order preserved).
+struct BroadPhaseEntry {
+    entt::entity entity; ///< Owning entity.
+    float x;             ///< Hitbox centre X (position + offset).
+    float y;             ///< Hitbox centre Y (position + offset).
+    float radius;        ///< Hitbox radius.
+};
+
+/// @brief Registry-context broad-phase state reused by update_collision.
+///
+/// Both grids are rebuilt from Transform2D + CircleHitbox (and the
+/// BulletPool) once per tick. Created on first use sized to the 480x270
+/// virtual area; GameScene resizes it to the level bounds via
+/// configure_collision_bounds().
+///
+/// Enemy-owned pooled bullets go into enemy_bullets after the registry ones,
+/// with entity null; id - pool_begin indexes pool_slots.
+struct CollisionBroadPhase {
+    SpatialGrid enemy_bullets;                        ///< Enemy-owned bullets, queried by players.
+    SpatialGrid enemies;                              ///< Enemies, queried by player bullets.
+    std::vector<BroadPhaseEntry> bullet_items;        ///< Entries indexed by enemy_bullets ids.
+    std::vector<BroadPhaseEntry> enemy_items;         ///< Entries indexed by enemies ids.
+    std::vector<BroadPhaseEntry> player_bullet_items; ///< Player bullets, in view order.
+    uint32_t pool_begin = 0;                          ///< First bullet_items id from the pool.
+    std::vector<std::size_t> pool_slots;              ///< Pool slot of each pooled bullet item.
+    std::vector<uint32_t> candidates;                 ///< Query scratch buffer.
+    CircleSoA candidate_circles;                      ///< Candidates gathered for the batch kernel.
+    std::vector<uint32_t> hits;                       ///< Overlapping ids, in candidate order.
+    std::vector<std::size_t> pool_kills;              ///< BulletPool slots consumed this tick.
+    std::vector<std::pair<std::size_t, entt::entity>> pool_pierces; ///< (slot, enemy) to record.
+};
+
+/// @brief Size the collision broad-phase to the current level.
+///
+/// Entities outside the bounds still collide correctly (they clamp to the
+/// edge cells); the bounds only control how finely space is divided.
+/// @param reg The ECS registry (the broad-phase lives in its context).
+/// @param width Level width in pixels.
+/// @param height Level height in pixels.
+void configure_collision_bounds(entt::registry& reg, float width, float height);
+
+/// @brief Find bullet-vs-actor overlaps and append them to a contact buffer.
+///
+/// Uses circle-circle checks for player vs enemy bullets and player
+/// bullets vs enemies. A uniform-grid broad-phase limits each check to
+/// nearby cells; results are identical to testing every pair. The
+/// registry is not modified (beyond the broad-phase scratch in ctx).
+///
+/// Bullets in a BulletPool go through the same grids. Their contacts carry
+/// a null source; the consumed slots and piercing hits are queued in the
+/// broad-phase for resolve_contacts() to apply to the pool.
+/// @param reg The ECS registry containing entities with hitbox components.
+/// @param out Buffer to fill; cleared first.
+void detect_collisions(entt::registry& reg, ContactBuffer& out);
+
+/// @brief Apply a tick's contacts: damage, knockback, piercing, audio, destruction.
+///
+/// Each consumer walks the buffer once. Hit sounds are pushed at most once
+/// per contact kind, and consumed bullets are destroyed in a single batch.
+/// Pooled bullets queued by detect_collisions() are removed from the pool.
+/// @param reg The ECS registry.
+/// @param contacts Contacts produced by detect_collisions().
+void resolve_contacts(entt::registry& reg, const ContactBuffer& contacts);
+
 /// @brief Detect and resolve collisions between hitbox-bearing entities.
 ///
-/// Uses circle-circle checks for player vs bullet and AABB for
-/// player projectiles vs enemy rect hitboxes. Applies DamageOnContact
-/// and marks colliding pairs for the damage system.
+/// Runs detect_collisions() into the registry-context ContactBuffer
+/// (created on first use) followed by resolve_contacts().
 /// @param reg The ECS registry containing entities with hitbox components.
 void update_collision(entt::registry& reg);
 
@@ -1,7 +1,9 @@
 #include "ecs/systems/damage_system.hpp"
 
 #include "core/string_id.hpp"
+#include "ecs/command_buffer.hpp"
 #include "ecs/components.hpp"
+#include "ecs/expiry_timers.hpp"
 
 #include <spdlog/spdlog.h>
 
@@ -82,13 +84,31 @@ void handle_enemy_death(entt::registry& reg, entt::entity entity, raven::StringI
 
 namespace raven::systems {
 
+void apply_contact_damage(entt::registry& reg, const std::vector<Contact>& contacts) {
+    auto health = reg.view<Health>();
+    for (const auto& contact : contacts) {
+        if (!health.contains(contact.target))
+            continue;
+
+        health.get<Health>(contact.target).current -= contact.damage;
+
+        // Grant invulnerability frames
+        if (contact.kind == Contact::Kind::PlayerHit) {
+            reg.emplace_or_replace<Invulnerable>(contact.target, 2.f);
+        }
+    }
+}
+
 void update_damage(entt::registry& reg, const PatternLibrary& /*patterns*/, float dt) {
     auto& interner = reg.ctx().get<StringInterner>();
 
-    tick_invulnerability(reg, dt);
+    // With ExpiryTimers, Invulnerable is removed by the timer wheel in cleanup
+    if (!reg.ctx().contains<ExpiryTimers>()) {
+        tick_invulnerability(reg, dt);
+    }
 
     // Check for dead entities
-    std::vector<entt::entity> to_destroy;
+    DeferredCommands cmds(reg);
     auto health_view = reg.view<Health>();
     for (auto [entity, hp] : health_view.each()) {
         if (hp.current <= 0.f) {
@@ -96,16 +116,10 @@ void update_damage(entt::registry& reg, const PatternLibrary& /*patterns*/, floa
                 handle_player_death(reg, entity, hp, *player);
             } else {
                 handle_enemy_death(reg, entity, interner);
-                to_destroy.push_back(entity);
+                cmds->destroy(entity);
             }
         }
     }
-
-    for (auto entity : to_destroy) {
-        if (reg.valid(entity)) {
-            reg.destroy(entity);
-        }
-    }
 }
 
 } // namespace raven::systems
@@ -1,11 +1,23 @@
 #pragma once
 
+#include "ecs/components.hpp"
 #include "patterns/pattern_library.hpp"
 
 #include <entt/entt.hpp>
 
+#include <vector>
+
 namespace raven::systems {
 
+/// @brief Apply the damage half of this tick's collision contacts.
+///
+/// Subtracts each contact's damage from the target's Health and grants
+/// players hit by enemy bullets two seconds of invulnerability. Death is
+/// handled later by update_damage().
+/// @param reg The ECS registry containing the hit entities.
+/// @param contacts Contacts produced by the collision phase, in order.
+void apply_contact_damage(entt::registry& reg, const std::vector<Contact>& contacts);
+
 /// @brief Process damage from collisions, apply invulnerability, and destroy dead entities.
 ///
 /// Reads DamageOnContact results flagged by the collision system.
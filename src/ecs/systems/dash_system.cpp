@@ -1,8 +1,8 @@
 #include "ecs/systems/dash_system.hpp"
 
 #include "ecs/components.hpp"
+#include "ecs/expiry_timers.hpp"
 
-#include <algorithm>
 #include <cmath>
 
 namespace raven::systems {
@@ -51,8 +51,7 @@ void update_dash(entt::registry& reg, const InputState& input, float dt) {
 
         // Grant invulnerability (slightly longer than dash for grace period).
         // Never shorten i-frames already granted, e.g. by a recent hit.
-        auto& inv = reg.get_or_emplace<Invulnerable>(entity, 0.f);
-        inv.remaining = std::max(inv.remaining, 0.18f);
+        extend_invulnerability(reg, entity, 0.18f);
     }
 
     // Process active dashes: override velocity
@@ -0,0 +1,128 @@
+#include "ecs/systems/debug_draw_system.hpp"
+
+#include "ecs/components.hpp"
+#include "ecs/systems/ai_system.hpp"
+#include "ecs/systems/bullet_pool.hpp"
+#include "ecs/systems/collision_system.hpp"
+#include "ecs/systems/player_utils.hpp"
+
+#include <cstddef>
+
+namespace raven::systems {
+
+namespace {
+
+constexpr SDL_Color PLAYER_COLOR{0, 220, 255, 255};
+constexpr SDL_Color ENEMY_COLOR{255, 80, 255, 255};
+constexpr SDL_Color ENEMY_BULLET_COLOR{255, 70, 70, 255};
+constexpr SDL_Color PLAYER_BULLET_COLOR{255, 230, 80, 255};
+constexpr SDL_Color OTHER_COLOR{180, 180, 180, 255};
+
+/// @brief Hitbox colour for an entity's side.
+SDL_Color side_color(const entt::registry& reg, entt::entity entity) {
+    if (reg.all_of<Player>(entity)) {
+        return PLAYER_COLOR;
+    }
+    if (const auto* bullet = reg.try_get<Bullet>(entity)) {
+        return bullet->owner == Bullet::Owner::Player ? PLAYER_BULLET_COLOR : ENEMY_BULLET_COLOR;
+    }
+    if (reg.all_of<Enemy>(entity)) {
+        return ENEMY_COLOR;
+    }
+    return OTHER_COLOR;
+}
+
+/// @brief Sides for a circle: bullets are tiny and numerous, so they get fewer.
+int circle_sides(float radius) {
+    return radius < 6.f ? 8 : DebugDraw::CIRCLE_SEGMENTS;
+}
+
+void record_hitboxes(entt::registry& reg, DebugDraw& out) {
+    for (auto [entity, tf, hb] : reg.view<Transform2D, CircleHitbox>().each()) {
+        out.circle(tf.x + hb.offset_x, tf.y + hb.offset_y, hb.radius, side_color(reg, entity),
+                   circle_sides(hb.radius));
+    }
+    for (auto [entity, tf, hb] : reg.view<Transform2D, RectHitbox>().each()) {
+        out.rect({tf.x + hb.offset_x - hb.width / 2.f, tf.y + hb.offset_y - hb.height / 2.f,
+                  hb.width, hb.height},
+                 side_color(reg, entity));
+    }
+    if (const auto* pool = reg.ctx().find<BulletPool>()) {
+        for (std::size_t i = 0; i < pool->size(); ++i) {
+            out.circle(pool->x[i], pool->y[i], pool->radius[i],
+                       pool->owner[i] == Bullet::Owner::Player ? PLAYER_BULLET_COLOR
+                                                               : ENEMY_BULLET_COLOR,
+                       circle_sides(pool->radius[i]));
+        }
+    }
+}
+
+void record_melee(entt::registry& reg, DebugDraw& out) {
+    for (auto [entity, tf, melee] : reg.view<Transform2D, MeleeAttack>().each()) {
+        out.cone(tf.x, tf.y, melee.aim_x, melee.aim_y, melee.range, melee.half_angle,
+                 {255, 160, 40, 255});
+    }
+}
+
+void record_sight(entt::registry& reg, const Tilemap& tilemap, DebugDraw& out) {
+    float player_x = 0.f;
+    float player_y = 0.f;
+    if (!find_player_position(reg, player_x, player_y)) {
+        return;
+    }
+    for (auto [entity, tf, ai] : reg.view<Transform2D, AiBehavior>().each()) {
+        const float dx = player_x - tf.x;
+        const float dy = player_y - tf.y;
+        const bool in_range = dx * dx + dy * dy <= ai.activation_range * ai.activation_range;
+        const bool clear = has_line_of_sight(tilemap, tf.x, tf.y, player_x, player_y);
+        SDL_Color color = clear ? SDL_Color{80, 255, 80, 255} : SDL_Color{255, 60, 60, 255};
+        if (!in_range) {
+            color.a = 70;
+        }
+        out.line(tf.x, tf.y, player_x, player_y, color);
+    }
+}
+
+void record_grid(const SpatialGrid& grid, SDL_Color color, DebugDraw& out) {
+    if (!grid.configured()) {
+        return;
+    }
+    const float size = grid.cell_size();
+    for (int row = 0; row < grid.rows(); ++row) {
+        for (int col = 0; col < grid.cols(); ++col) {
+            if (!grid.cell(col, row).empty()) {
+                out.rect({static_cast<float>(col) * size, static_cast<float>(row) * size, size,
+                          size},
+                         color);
+            }
+        }
+    }
+}
+
+} // namespace
+
+void extract_debug_draw(entt::registry& reg, const Tilemap& tilemap, DebugDraw& out) {
+    out.clear();
+    const auto* flags = reg.ctx().find<DebugDrawFlags>();
+    if (!flags || !flags->any()) {
+        return;
+    }
+
+    if (flags->grid) {
+        if (const auto* bp = reg.ctx().find<CollisionBroadPhase>()) {
+            record_grid(bp->enemies, {255, 80, 255, 90}, out);
+            record_grid(bp->enemy_bullets, {255, 70, 70, 90}, out);
+        }
+    }
+    if (flags->hitboxes) {
+        record_hitboxes(reg, out);
+    }
+    if (flags->melee) {
+        record_melee(reg, out);
+    }
+    if (flags->sight) {
+        record_sight(reg, tilemap, out);
+    }
+}
+
+} // namespace raven::systems
@@ -0,0 +1,23 @@
+#pragma once
+
+#include "rendering/debug_draw.hpp"
+#include "rendering/tilemap.hpp"
+
+#include <entt/entt.hpp>
+
+namespace raven::systems {
+
+/// @brief Record the debug shapes enabled by the ctx DebugDrawFlags.
+///
+/// Hitboxes are coloured by side (player cyan, enemies magenta, enemy
+/// bullets red, player bullets yellow). Sight rays run from each AI enemy
+/// to the player, green when clear and red when the tilemap blocks them,
+/// dimmed beyond the enemy's activation range. Grid cells come from the
+/// enemy and enemy-bullet broad-phase grids. Runs on the simulation side
+/// when a snapshot is published; touches no SDL state.
+/// @param reg The ECS registry.
+/// @param tilemap The tilemap used for line-of-sight checks.
+/// @param out Cleared, then filled in world pixels.
+void extract_debug_draw(entt::registry& reg, const Tilemap& tilemap, DebugDraw& out);
+
+} // namespace raven::systems
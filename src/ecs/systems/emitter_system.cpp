@@ -6,6 +6,7 @@
 #include "ecs/systems/player_utils.hpp"
 
 #include <cmath>
+#include <cstddef>
 
 namespace raven::systems {
 
@@ -15,52 +16,58 @@ constexpr float PI = 3.14159265358979323846f;
 constexpr float DEG_TO_RAD = PI / 180.f;
 
 /// @brief Fire a burst of bullets from an emitter at a given angle.
+///
+/// Directions come from the emitter's precomputed BurstTable rotated by the
+/// center angle, so only the center needs cos/sin.
 void fire_burst(entt::registry& reg, const EmitterDef& emitter, float center_angle_deg,
                 float origin_x, float origin_y) {
     float center_rad = center_angle_deg * DEG_TO_RAD;
+    float cx = std::cos(center_rad);
+    float cy = std::sin(center_rad);
+
+    BulletSpawnParams params;
+    params.origin_x = origin_x;
+    params.origin_y = origin_y;
+    params.angle_rad = center_rad;
+    params.dir_x = cx;
+    params.dir_y = cy;
+    params.has_dir = true;
+    params.analytic = true;
+    params.angular_velocity = emitter.bullet_angular_velocity * DEG_TO_RAD;
+    params.acceleration = emitter.bullet_acceleration;
+    params.speed = emitter.speed;
+    params.damage = emitter.damage;
+    params.lifetime = emitter.lifetime;
+    params.hitbox_radius = emitter.hitbox_radius;
+    params.owner = Bullet::Owner::Enemy;
+    params.sheet_id = emitter.bullet_sheet;
+    params.frame_x = emitter.bullet_frame_x;
+    params.frame_y = emitter.bullet_frame_y;
+    params.width = emitter.bullet_width;
+    params.height = emitter.bullet_height;
 
     if (emitter.count <= 1) {
-        BulletSpawnParams params;
-        params.origin_x = origin_x;
-        params.origin_y = origin_y;
-        params.angle_rad = center_rad;
-        params.speed = emitter.speed;
-        params.damage = emitter.damage;
-        params.lifetime = emitter.lifetime;
-        params.hitbox_radius = emitter.hitbox_radius;
-        params.owner = Bullet::Owner::Enemy;
-        params.sheet_id = emitter.bullet_sheet;
-        params.frame_x = emitter.bullet_frame_x;
-        params.frame_y = emitter.bullet_frame_y;
-        params.width = emitter.bullet_width;
-        params.height = emitter.bullet_height;
         spawn_bullet(reg, params);
         return;
     }
 
-    float spread_rad = emitter.spread_angle * DEG_TO_RAD;
-    float step = spread_rad / static_cast<float>(emitter.count);
-    float start = center_rad - spread_rad / 2.f;
-
-    for (int i = 0; i < emitter.count; ++i) {
-        float angle = start + step * static_cast<float>(i) + step / 2.f;
-
-        BulletSpawnParams params;
-        params.origin_x = origin_x;
-        params.origin_y = origin_y;
-        params.angle_rad = angle;
-        params.speed = emitter.speed;
-        params.damage = emitter.damage;
-        params.lifetime = emitter.lifetime;
-        params.hitbox_radius = emitter.hitbox_radius;
-        params.owner = Bullet::Owner::Enemy;
-        params.sheet_id = emitter.bullet_sheet;
-        params.frame_x = emitter.bullet_frame_x;
-        params.frame_y = emitter.bullet_frame_y;
-        params.width = emitter.bullet_width;
-        params.height = emitter.bullet_height;
-        spawn_bullet(reg, params);
+    // Hand-built EmitterDefs (not from parse_emitter) have no table yet
+    const BurstTable* table = &emitter.burst;
+    BurstTable local;
+    if (!table->matches(emitter.count, emitter.spread_angle)) {
+        local.build(emitter.count, emitter.spread_angle);
+        table = &local;
+    }
+
+    // Persistent scratch buffer — cleared each burst, capacity stays allocated
+    auto& burst = reg.ctx().emplace<BulletSpawnScratch>().params;
+    burst.clear();
+    for (std::size_t i = 0; i < table->size(); ++i) {
+        params.angle_rad = center_rad + table->angle_off[i];
+        table->rotate(i, cx, cy, params.dir_x, params.dir_y);
+        burst.push_back(params);
     }
+    spawn_bullets(reg, burst);
 }
 
 } // anonymous namespace
@@ -78,7 +85,7 @@ void update_emitters(entt::registry& reg, const PatternLibrary& patterns, float
             continue;
         }
 
-        const auto* pattern = patterns.get(interner.resolve(emitter.pattern_name));
+        const auto* pattern = patterns.resolve(emitter, interner);
         if (!pattern) {
             continue;
         }
@@ -9,8 +9,8 @@ namespace raven::systems {
 /// @brief Tick bullet emitters and spawn enemy bullets from pattern definitions.
 ///
 /// For each entity with a BulletEmitter component, looks up the referenced
-/// PatternDef, advances rotation and cooldown timers, and spawns bullets
-/// on cooldown expiry.
+/// PatternDef by its cached PatternId (resolved from the name on first use),
+/// advances rotation and cooldown timers, and spawns bullets on cooldown expiry.
 /// @param reg The ECS registry containing emitter entities.
 /// @param patterns The loaded pattern library.
 /// @param dt Fixed timestep delta in seconds.
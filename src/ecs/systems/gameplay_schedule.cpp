@@ -0,0 +1,224 @@
+#include "ecs/systems/gameplay_schedule.hpp"
+
+#include "core/string_id.hpp"
+#include "ecs/command_buffer.hpp"
+#include "ecs/components.hpp"
+#include "ecs/expiry_timers.hpp"
+#include "ecs/systems/ai_system.hpp"
+#include "ecs/systems/animation_system.hpp"
+#include "ecs/systems/bullet_pool.hpp"
+#include "ecs/systems/bullet_spawn.hpp"
+#include "ecs/systems/camera_system.hpp"
+#include "ecs/systems/charged_shot_system.hpp"
+#include "ecs/systems/cleanup_system.hpp"
+#include "ecs/systems/collision_system.hpp"
+#include "ecs/systems/concussion_shot_system.hpp"
+#include "ecs/systems/damage_system.hpp"
+#include "ecs/systems/dash_system.hpp"
+#include "ecs/systems/emitter_system.hpp"
+#include "ecs/systems/ground_slam_system.hpp"
+#include "ecs/systems/input_system.hpp"
+#include "ecs/systems/melee_system.hpp"
+#include "ecs/systems/movement_system.hpp"
+#include "ecs/systems/pickup_system.hpp"
+#include "ecs/systems/shooting_system.hpp"
+#include "ecs/systems/tile_collision_system.hpp"
+#include "patterns/burst_table.hpp"
+#include "rendering/renderer.hpp"
+
+#include <random>
+
+namespace {
+
+using raven::SystemAccess;
+
+/// @brief Add what spawn_bullet()/spawn_bullets() touch.
+///
+/// Pooled bullets only write the BulletPool. Registry bullets (no pool, as
+/// in tests) create entities and emplace every bullet component, so those
+/// systems run alone.
+SystemAccess spawning(SystemAccess access, bool pooled) {
+    access.reads_ctx<raven::SimTick>();
+    if (pooled) {
+        access.writes_ctx<raven::systems::BulletPool>();
+    } else {
+        access.exclusive();
+    }
+    return access;
+}
+
+/// @brief Add what DeferredCommands touches: the shared buffer, or (without
+/// one) an immediate destroy across every storage at scope exit.
+SystemAccess destroying(SystemAccess access, bool deferred) {
+    if (deferred) {
+        access.writes_ctx<raven::CommandBuffer>();
+    } else {
+        access.exclusive();
+    }
+    return access;
+}
+
+} // namespace
+
+namespace raven::systems {
+
+void build_gameplay_schedule(SystemScheduler& scheduler, entt::registry& reg,
+                             const GameplayFrame& frame) {
+    const bool pooled = reg.ctx().contains<BulletPool>();
+    const bool deferred = reg.ctx().contains<CommandBuffer>();
+    const GameplayFrame* f = &frame;
+    entt::registry* r = &reg;
+
+    scheduler.clear();
+
+    // Emplacing or removing a component reads the entity storage (EnTT
+    // validates the handle), so structural systems declare entt::entity.
+
+    scheduler.add("charged_shot",
+                  spawning(SystemAccess{}
+                               .reads<Player, Weapon, AimDirection, Transform2D, Dash>()
+                               .writes<ChargedShot, ShootCooldown>()
+                               .writes_ctx<AudioQueue>(),
+                           pooled),
+                  [r, f] { update_charged_shot(*r, *f->input, f->dt); });
+
+    scheduler.add("input", SystemAccess{}.reads<ChargedShot, Dash>().writes<Player, Velocity>(),
+                  [r, f] { update_input(*r, *f->input, f->dt); });
+
+    scheduler.add("melee",
+                  SystemAccess{}
+                      .reads<Player, AimDirection, MeleeStats, Enemy>()
+                      .writes<MeleeCooldown, MeleeAttack, Health, Knockback, Disarmed,
+                              BulletEmitter, Transform2D, PreviousTransform, CircleHitbox,
+                              Lifetime, Sprite, WeaponPickup>()
+                      .creates_entities()
+                      .writes_ctx<StringInterner, AudioQueue, ExpiryTimers>(),
+                  [r, f] { update_melee(*r, *f->input, *f->patterns, f->dt); });
+
+    scheduler.add("dash",
+                  SystemAccess{}
+                      .reads<entt::entity, Player, AimDirection>()
+                      .writes<DashCooldown, Dash, Velocity, Invulnerable>()
+                      .writes_ctx<AudioQueue, ExpiryTimers>(),
+                  [r, f] { update_dash(*r, *f->input, f->dt); });
+
+    scheduler.add("ground_slam",
+                  SystemAccess{}
+                      .reads<entt::entity, Player, Transform2D, CircleHitbox, Enemy, Dash>()
+                      .writes<GroundSlamCooldown, GroundSlam, Health, Knockback>(),
+                  [r, f] { update_ground_slam(*r, *f->input, f->dt); });
+
+    scheduler.add("concussion_shot",
+                  SystemAccess{}
+                      .reads<entt::entity, Player, Transform2D, CircleHitbox, Enemy, Dash>()
+                      .writes<ConcussionShotCooldown, ConcussionShot, Health, Knockback>(),
+                  [r, f] { update_concussion_shot(*r, *f->input, f->dt); });
+
+    scheduler.add("shooting",
+                  spawning(SystemAccess{}
+                               .reads<Player, Transform2D, Weapon, ChargedShot>()
+                               .writes<ShootCooldown, AimDirection>()
+                               .reads_ctx<Camera>()
+                               .writes_ctx<AudioQueue>()
+                               .scratch<BurstTableCache, BulletSpawnScratch>(),
+                           pooled),
+                  [r, f] { update_shooting(*r, *f->input, f->dt); });
+
+    scheduler.add("emitters",
+                  spawning(SystemAccess{}
+                               .reads<Player, Transform2D>()
+                               .writes<BulletEmitter>()
+                               .reads_ctx<StringInterner>()
+                               .scratch<BulletSpawnScratch>(),
+                           pooled),
+                  [r, f] { update_emitters(*r, *f->patterns, f->dt); });
+
+    scheduler.add("ai",
+                  SystemAccess{}
+                      .reads<entt::entity, Player, Transform2D, CircleHitbox, Disarmed>()
+                      .writes<Velocity, AiBehavior, Knockback, ContactDamage, Health, Invulnerable,
+                              BulletEmitter>()
+                      .writes_ctx<std::mt19937, ExpiryTimers>(),
+                  [r, f] { update_ai(*r, *f->tilemap, f->dt); });
+
+    scheduler.add("animation_state",
+                  SystemAccess{}
+                      .reads<Player, Velocity, MeleeAttack, GroundSlam, Dash, AimDirection>()
+                      .writes<Animation, Sprite, AnimationState>(),
+                  [r] { update_animation_state(*r); });
+
+    scheduler.add("animation", SystemAccess{}.writes<Animation, Sprite>(),
+                  [r, f] { update_animation(*r, f->dt); });
+
+    scheduler.add("movement",
+                  SystemAccess{}
+                      .reads<BulletMotion, Player, Sprite>()
+                      .writes<Transform2D, PreviousTransform, Velocity>()
+                      .reads_ctx<SimTick, Camera>()
+                      .writes_ctx<BulletPool>(),
+                  [r, f] { update_movement(*r, f->dt); });
+
+    scheduler.add("tile_collision",
+                  SystemAccess{}
+                      .reads<RectHitbox>()
+                      .writes<Transform2D, PreviousTransform, Velocity>(),
+                  [r, f] { update_tile_collision(*r, *f->tilemap); });
+
+    scheduler.add("camera", SystemAccess{}.reads<Player, Transform2D>().writes_ctx<Camera>(),
+                  [r] { update_camera(*r); });
+
+    scheduler.add("collision",
+                  destroying(SystemAccess{}
+                                 .reads<entt::entity, Transform2D, CircleHitbox, Bullet,
+                                        DamageOnContact, Enemy, Player, Velocity>()
+                                 .writes<Health, Knockback, Invulnerable, Piercing>()
+                                 .scratch<ContactBuffer, CollisionBroadPhase>()
+                                 .writes_ctx<BulletPool, AudioQueue, ExpiryTimers>(),
+                             deferred),
+                  [r] { update_collision(*r); });
+
+    scheduler.add("pickups",
+                  destroying(SystemAccess{}
+                                 .reads<entt::entity, Transform2D, CircleHitbox, Player,
+                                        WeaponPickup, StabilizerPickup>()
+                                 .writes<Weapon, DefaultWeapon, WeaponDecay>()
+                                 .writes_ctx<AudioQueue>(),
+                             deferred),
+                  [r] { update_pickups(*r); });
+
+    scheduler.add("weapon_decay",
+                  SystemAccess{}
+                      .reads<Player>()
+                      .writes<WeaponDecay, Weapon, DefaultWeapon, Health, Invulnerable,
+                              Transform2D, Lifetime, ExplosionVfx>()
+                      .creates_entities()
+                      .writes_ctx<ExpiryTimers>(),
+                  [r, f] { update_weapon_decay(*r, f->dt); });
+
+    scheduler.add("damage",
+                  destroying(SystemAccess{}
+                                 .reads<Enemy, ScoreValue>()
+                                 .writes<Health, Player, Invulnerable, Transform2D,
+                                         PreviousTransform, CircleHitbox, Lifetime, Sprite,
+                                         StabilizerPickup>()
+                                 .creates_entities()
+                                 .writes_ctx<GameState, std::mt19937, StringInterner, AudioQueue,
+                                             ExpiryTimers>(),
+                             deferred),
+                  [r, f] { update_damage(*r, *f->patterns, f->dt); });
+
+    scheduler.add("cleanup",
+                  destroying(SystemAccess{}
+                                 .reads<entt::entity, Transform2D, OffScreenDespawn>()
+                                 .writes<Lifetime, Invulnerable>()
+                                 .reads_ctx<Camera>()
+                                 .writes_ctx<ExpiryTimers, BulletPool>(),
+                             deferred),
+                  [r, f] {
+                      update_cleanup(*r, f->dt, Renderer::VIRTUAL_WIDTH, Renderer::VIRTUAL_HEIGHT);
+                  });
+
+    scheduler.prepare(reg);
+}
+
+} // namespace raven::systems
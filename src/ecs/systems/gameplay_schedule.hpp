@@ -0,0 +1,40 @@
+#pragma once
+
+#include "core/input.hpp"
+#include "ecs/system_scheduler.hpp"
+#include "patterns/pattern_library.hpp"
+#include "rendering/tilemap.hpp"
+
+#include <entt/entt.hpp>
+
+namespace raven::systems {
+
+/// @brief Per-tick inputs of the gameplay systems, owned by the caller.
+///
+/// The scheduled systems read through these pointers each run, so the
+/// caller refreshes them (dt, input) before SystemScheduler::run().
+struct GameplayFrame {
+    const InputState* input = nullptr;        ///< This tick's input snapshot.
+    const PatternLibrary* patterns = nullptr; ///< Loaded bullet patterns.
+    const Tilemap* tilemap = nullptr;         ///< Current room.
+    float dt = 0.f;                           ///< Fixed timestep delta in seconds.
+};
+
+/// @brief Add every per-tick gameplay system, in serial order, to @p scheduler.
+///
+/// Runs charged shot through cleanup, with each system's component and ctx
+/// accesses declared so independent ones can overlap. The CommandBuffer
+/// flush, waves and audio forwarding stay with the caller after run().
+///
+/// Accesses are declared for the registry as it is when this is called:
+/// with a BulletPool, spawning bullets touches only the pool; with a
+/// CommandBuffer, destroys are deferred. Without either, the systems that
+/// would create or destroy entities run exclusively. Also calls
+/// SystemScheduler::prepare on @p reg.
+/// @param scheduler Scheduler to fill (cleared first).
+/// @param reg The ECS registry the systems run against.
+/// @param frame Per-tick inputs; must outlive the scheduler's use.
+void build_gameplay_schedule(SystemScheduler& scheduler, entt::registry& reg,
+                             const GameplayFrame& frame);
+
+} // namespace raven::systems
@@ -4,6 +4,7 @@
 #include "ecs/systems/hitbox_math.hpp"
 
 #include <cmath>
+#include <cstddef>
 #include <vector>
 
 namespace raven::systems {
@@ -50,22 +51,31 @@ void update_ground_slam(entt::registry& reg, const InputState& input, float dt)
             };
             std::vector<HitInfo> hits;
 
+            // Gather enemy hitboxes once, then test them in batches
+            CircleSoA targets;
+            std::vector<entt::entity> target_ents;
             for (auto [e_ent, e_tf, e_hb, enemy, e_hp] : enemy_view.each()) {
-                if (circles_overlap(tf.x, tf.y, slam.radius, e_tf.x + e_hb.offset_x,
-                                    e_tf.y + e_hb.offset_y, e_hb.radius)) {
-                    float dx = e_tf.x - tf.x;
-                    float dy = e_tf.y - tf.y;
-                    float dist = std::sqrt(dx * dx + dy * dy);
-                    float kb_x = 0.f;
-                    float kb_y = 0.f;
-                    if (dist > 0.f) {
-                        kb_x = dx / dist;
-                        kb_y = dy / dist;
-                    }
-                    hits.push_back({e_ent, kb_x, kb_y});
-                }
+                targets.push(e_tf.x + e_hb.offset_x, e_tf.y + e_hb.offset_y, e_hb.radius);
+                target_ents.push_back(e_ent);
             }
 
+            const Transform2D& origin = tf; // older Clang cannot capture structured bindings
+            for_each_hit(targets, tf.x, tf.y, slam.radius, [&](std::size_t i) {
+                auto e_ent = target_ents[i];
+
+                const auto& e_tf = enemy_view.get<Transform2D>(e_ent);
+                float dx = e_tf.x - origin.x;
+                float dy = e_tf.y - origin.y;
+                float dist = std::sqrt(dx * dx + dy * dy);
+                float kb_x = 0.f;
+                float kb_y = 0.f;
+                if (dist > 0.f) {
+                    kb_x = dx / dist;
+                    kb_y = dy / dist;
+                }
+                hits.push_back({e_ent, kb_x, kb_y});
+            });
+
             for (auto& hit : hits) {
                 auto& e_hp = reg.get<Health>(hit.ent);
                 e_hp.current -= slam.damage;
@@ -1,6 +1,24 @@
 #pragma once
 
+#include <algorithm>
+#include <bit>
 #include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+// Batch kernels pick the widest instruction set enabled at compile time:
+// SSE2 on any x86-64 build, AVX2 when built with -mavx2 (or /arch:AVX2).
+// Define RAVEN_NO_SIMD to force the scalar fallback. The tests build the
+// kernel checks in all three configurations (see tests/CMakeLists.txt).
+#if !defined(RAVEN_NO_SIMD) && defined(__AVX2__)
+#define RAVEN_HITBOX_AVX2 1
+#define RAVEN_HITBOX_SSE2 1
+#include <immintrin.h>
+#elif !defined(RAVEN_NO_SIMD) && (defined(__SSE2__) || defined(_M_X64))
+#define RAVEN_HITBOX_SSE2 1
+#include <emmintrin.h>
+#endif
 
 namespace raven::systems {
 
@@ -63,4 +81,295 @@ namespace raven::systems {
     return dot >= std::cos(half_angle);
 }
 
+// ── Batched kernels ─────────────────────────────────────────────
+
+/// @brief Maximum lanes per batch call (one bit per lane in the result).
+inline constexpr std::size_t HITBOX_BATCH_WIDTH = 64;
+
+/// @brief Structure-of-arrays circle list for the batch kernels.
+///
+/// Systems gather hitbox centres (position + offset) and radii here once,
+/// then test a query shape against them in chunks of HITBOX_BATCH_WIDTH.
+struct CircleSoA {
+    std::vector<float> x; ///< Centre X per circle.
+    std::vector<float> y; ///< Centre Y per circle.
+    std::vector<float> r; ///< Radius per circle.
+
+    /// @brief Remove all circles, keeping capacity.
+    void clear() {
+        x.clear();
+        y.clear();
+        r.clear();
+    }
+
+    /// @brief Append one circle.
+    void push(float cx, float cy, float radius) {
+        x.push_back(cx);
+        y.push_back(cy);
+        r.push_back(radius);
+    }
+
+    /// @brief Number of circles stored.
+    [[nodiscard]] std::size_t size() const { return x.size(); }
+};
+
+/// @brief Test one circle against up to 64 circles stored as SoA.
+///
+/// Each lane performs the same operations as circles_overlap(), so the
+/// result is bit-for-bit identical to calling it per element.
+/// @param x Centre X of the query circle.
+/// @param y Centre Y of the query circle.
+/// @param r Radius of the query circle.
+/// @param xs Centre X array.
+/// @param ys Centre Y array.
+/// @param rs Radius array.
+/// @param count Number of lanes to test (at most HITBOX_BATCH_WIDTH).
+/// @return Bit i set when the query circle overlaps circle i.
+[[nodiscard]] inline uint64_t circles_overlap_batch(float x, float y, float r, const float* xs,
+                                                    const float* ys, const float* rs,
+                                                    std::size_t count) {
+    uint64_t mask = 0;
+    std::size_t i = 0;
+
+#if defined(RAVEN_HITBOX_AVX2)
+    {
+        const __m256 vx = _mm256_set1_ps(x);
+        const __m256 vy = _mm256_set1_ps(y);
+        const __m256 vr = _mm256_set1_ps(r);
+        for (; i + 8 <= count; i += 8) {
+            __m256 dx = _mm256_sub_ps(_mm256_loadu_ps(xs + i), vx);
+            __m256 dy = _mm256_sub_ps(_mm256_loadu_ps(ys + i), vy);
+            __m256 dist_sq = _mm256_add_ps(_mm256_mul_ps(dx, dx), _mm256_mul_ps(dy, dy));
+            __m256 radii = _mm256_add_ps(vr, _mm256_loadu_ps(rs + i));
+            __m256 hit = _mm256_cmp_ps(dist_sq, _mm256_mul_ps(radii, radii), _CMP_LE_OQ);
+            auto bits = static_cast<unsigned>(_mm256_movemask_ps(hit));
+            mask |= static_cast<uint64_t>(bits) << i;
+        }
+    }
+#endif
+#if defined(RAVEN_HITBOX_SSE2)
+    {
+        const __m128 vx = _mm_set1_ps(x);
+        const __m128 vy = _mm_set1_ps(y);
+        const __m128 vr = _mm_set1_ps(r);
+        for (; i + 4 <= count; i += 4) {
+            __m128 dx = _mm_sub_ps(_mm_loadu_ps(xs + i), vx);
+            __m128 dy = _mm_sub_ps(_mm_loadu_ps(ys + i), vy);
+            __m128 dist_sq = _mm_add_ps(_mm_mul_ps(dx, dx), _mm_mul_ps(dy, dy));
+            __m128 radii = _mm_add_ps(vr, _mm_loadu_ps(rs + i));
+            __m128 hit = _mm_cmple_ps(dist_sq, _mm_mul_ps(radii, radii));
+            auto bits = static_cast<unsigned>(_mm_movemask_ps(hit));
+            mask |= static_cast<uint64_t>(bits) << i;
+        }
+    }
+#endif
+
+    for (; i < count; ++i) {
+        if (circles_overlap(x, y, r, xs[i], ys[i], rs[i])) {
+            mask |= uint64_t{1} << i;
+        }
+    }
+    return mask;
+}
+
+/// @brief A cone with its aim normalised and cosine precomputed.
+///
+/// Build with make_cone() once per attack, then test it against any number
+/// of targets without repeating the aim sqrt or the cos().
+struct ConeQuery {
+    float origin_x = 0.f;   ///< Cone origin X.
+    float origin_y = 0.f;   ///< Cone origin Y.
+    float aim_nx = 0.f;     ///< Normalised aim X.
+    float aim_ny = 0.f;     ///< Normalised aim Y.
+    float range = 0.f;      ///< Base reach in pixels (per-target radius is added).
+    float cos_half = 1.f;   ///< cos(half_angle).
+    bool aim_valid = false; ///< False for a degenerate (near-zero) aim vector.
+};
+
+/// @brief Precompute a cone for points_in_cone_batch().
+/// @param origin_x Centre X of the cone origin.
+/// @param origin_y Centre Y of the cone origin.
+/// @param aim_x Aim direction X (does not need to be normalised).
+/// @param aim_y Aim direction Y (does not need to be normalised).
+/// @param range Base reach of the cone in pixels.
+/// @param half_angle Half-angle of the cone in radians.
+[[nodiscard]] inline ConeQuery make_cone(float origin_x, float origin_y, float aim_x, float aim_y,
+                                         float range, float half_angle) {
+    ConeQuery cone;
+    cone.origin_x = origin_x;
+    cone.origin_y = origin_y;
+    cone.range = range;
+    cone.cos_half = std::cos(half_angle);
+
+    float aim_len_sq = aim_x * aim_x + aim_y * aim_y;
+    if (aim_len_sq >= 0.0001f) {
+        float inv_aim_len = 1.f / std::sqrt(aim_len_sq);
+        cone.aim_nx = aim_x * inv_aim_len;
+        cone.aim_ny = aim_y * inv_aim_len;
+        cone.aim_valid = true;
+    }
+    return cone;
+}
+
+/// @brief Test up to 64 target points against a precomputed cone.
+///
+/// Lane i uses a reach of `cone.range + rs[i]` (callers pass hitbox radii
+/// for generosity, or zeros). Each lane performs the same operations as
+/// point_in_cone(), so the result is bit-for-bit identical to calling it
+/// per element with that reach.
+/// @param cone Cone built by make_cone().
+/// @param xs Target X array.
+/// @param ys Target Y array.
+/// @param rs Per-target reach extension array.
+/// @param count Number of lanes to test (at most HITBOX_BATCH_WIDTH).
+/// @return Bit i set when target i lies inside the cone.
+[[nodiscard]] inline uint64_t points_in_cone_batch(const ConeQuery& cone, const float* xs,
+                                                   const float* ys, const float* rs,
+                                                   std::size_t count) {
+    uint64_t mask = 0;
+    std::size_t i = 0;
+
+#if defined(RAVEN_HITBOX_AVX2)
+    {
+        const __m256 ox = _mm256_set1_ps(cone.origin_x);
+        const __m256 oy = _mm256_set1_ps(cone.origin_y);
+        const __m256 ax = _mm256_set1_ps(cone.aim_nx);
+        const __m256 ay = _mm256_set1_ps(cone.aim_ny);
+        const __m256 range = _mm256_set1_ps(cone.range);
+        const __m256 cos_half = _mm256_set1_ps(cone.cos_half);
+        const __m256 eps = _mm256_set1_ps(0.0001f);
+        const __m256 one = _mm256_set1_ps(1.f);
+        const __m256 aim_ok = cone.aim_valid ? _mm256_castsi256_ps(_mm256_set1_epi32(-1))
+                                             : _mm256_setzero_ps();
+        for (; i + 8 <= count; i += 8) {
+            __m256 dx = _mm256_sub_ps(_mm256_loadu_ps(xs + i), ox);
+            __m256 dy = _mm256_sub_ps(_mm256_loadu_ps(ys + i), oy);
+            __m256 dist_sq = _mm256_add_ps(_mm256_mul_ps(dx, dx), _mm256_mul_ps(dy, dy));
+            __m256 reach = _mm256_add_ps(range, _mm256_loadu_ps(rs + i));
+            __m256 in_range = _mm256_cmp_ps(dist_sq, _mm256_mul_ps(reach, reach), _CMP_LE_OQ);
+            __m256 at_origin = _mm256_cmp_ps(dist_sq, eps, _CMP_LT_OQ);
+
+            __m256 inv_dist = _mm256_div_ps(one, _mm256_sqrt_ps(dist_sq));
+            __m256 dot = _mm256_add_ps(_mm256_mul_ps(ax, _mm256_mul_ps(dx, inv_dist)),
+                                       _mm256_mul_ps(ay, _mm256_mul_ps(dy, inv_dist)));
+            __m256 in_angle = _mm256_and_ps(aim_ok, _mm256_cmp_ps(dot, cos_half, _CMP_GE_OQ));
+
+            __m256 hit = _mm256_and_ps(in_range, _mm256_or_ps(at_origin, in_angle));
+            auto bits = static_cast<unsigned>(_mm256_movemask_ps(hit));
+            mask |= static_cast<uint64_t>(bits) << i;
+        }
+    }
+#endif
+#if defined(RAVEN_HITBOX_SSE2)
+    {
+        const __m128 ox = _mm_set1_ps(cone.origin_x);
+        const __m128 oy = _mm_set1_ps(cone.origin_y);
+        const __m128 ax = _mm_set1_ps(cone.aim_nx);
+        const __m128 ay = _mm_set1_ps(cone.aim_ny);
+        const __m128 range = _mm_set1_ps(cone.range);
+        const __m128 cos_half = _mm_set1_ps(cone.cos_half);
+        const __m128 eps = _mm_set1_ps(0.0001f);
+        const __m128 one = _mm_set1_ps(1.f);
+        const __m128 aim_ok =
+            cone.aim_valid ? _mm_castsi128_ps(_mm_set1_epi32(-1)) : _mm_setzero_ps();
+        for (; i + 4 <= count; i += 4) {
+            __m128 dx = _mm_sub_ps(_mm_loadu_ps(xs + i), ox);
+            __m128 dy = _mm_sub_ps(_mm_loadu_ps(ys + i), oy);
+            __m128 dist_sq = _mm_add_ps(_mm_mul_ps(dx, dx), _mm_mul_ps(dy, dy));
+            __m128 reach = _mm_add_ps(range, _mm_loadu_ps(rs + i));
+            __m128 in_range = _mm_cmple_ps(dist_sq, _mm_mul_ps(reach, reach));
+            __m128 at_origin = _mm_cmplt_ps(dist_sq, eps);
+
+            __m128 inv_dist = _mm_div_ps(one, _mm_sqrt_ps(dist_sq));
+            __m128 dot = _mm_add_ps(_mm_mul_ps(ax, _mm_mul_ps(dx, inv_dist)),
+                                    _mm_mul_ps(ay, _mm_mul_ps(dy, inv_dist)));
+            __m128 in_angle = _mm_and_ps(aim_ok, _mm_cmpge_ps(dot, cos_half));
+
+            __m128 hit = _mm_and_ps(in_range, _mm_or_ps(at_origin, in_angle));
+            auto bits = static_cast<unsigned>(_mm_movemask_ps(hit));
+            mask |= static_cast<uint64_t>(bits) << i;
+        }
+    }
+#endif
+
+    for (; i < count; ++i) {
+        float dx = xs[i] - cone.origin_x;
+        float dy = ys[i] - cone.origin_y;
+        float dist_sq = dx * dx + dy * dy;
+        float reach = cone.range + rs[i];
+        if (dist_sq > reach * reach) {
+            continue;
+        }
+        if (dist_sq < 0.0001f) {
+            mask |= uint64_t{1} << i;
+            continue;
+        }
+        if (!cone.aim_valid) {
+            continue;
+        }
+        float inv_dist = 1.f / std::sqrt(dist_sq);
+        float dot = cone.aim_nx * (dx * inv_dist) + cone.aim_ny * (dy * inv_dist);
+        if (dot >= cone.cos_half) {
+            mask |= uint64_t{1} << i;
+        }
+    }
+    return mask;
+}
+
+namespace detail {
+
+/// @brief Run a batch kernel over @p soa in HITBOX_BATCH_WIDTH chunks.
+/// @param soa Circles to test.
+/// @param batch Called as batch(xs, ys, rs, count), returning a lane mask.
+/// @param fn Called with the index of each hit, in ascending order.
+template <typename Batch, typename Fn>
+void for_each_batch_hit(const CircleSoA& soa, Batch&& batch, Fn&& fn) {
+    for (std::size_t base = 0; base < soa.size(); base += HITBOX_BATCH_WIDTH) {
+        std::size_t count = std::min(HITBOX_BATCH_WIDTH, soa.size() - base);
+        uint64_t mask =
+            batch(soa.x.data() + base, soa.y.data() + base, soa.r.data() + base, count);
+        while (mask != 0) {
+            auto lane = static_cast<std::size_t>(std::countr_zero(mask));
+            mask &= mask - 1;
+            fn(base + lane);
+        }
+    }
+}
+
+} // namespace detail
+
+/// @brief Call @p fn for every circle in @p soa that overlaps the query circle.
+///
+/// Handles the chunking and tails; the hits match circles_overlap() per element.
+/// @param soa Circles to test.
+/// @param x Centre X of the query circle.
+/// @param y Centre Y of the query circle.
+/// @param r Radius of the query circle.
+/// @param fn Called with the index into @p soa of each hit, in ascending order.
+template <typename Fn>
+void for_each_hit(const CircleSoA& soa, float x, float y, float r, Fn&& fn) {
+    detail::for_each_batch_hit(
+        soa,
+        [x, y, r](const float* xs, const float* ys, const float* rs, std::size_t count) {
+            return circles_overlap_batch(x, y, r, xs, ys, rs, count);
+        },
+        fn);
+}
+
+/// @brief Call @p fn for every point in @p soa that lies inside the cone.
+///
+/// The radii in @p soa extend the reach per target, as in points_in_cone_batch().
+/// @param soa Target points and reach extensions.
+/// @param cone Cone built by make_cone().
+/// @param fn Called with the index into @p soa of each hit, in ascending order.
+template <typename Fn>
+void for_each_hit(const CircleSoA& soa, const ConeQuery& cone, Fn&& fn) {
+    detail::for_each_batch_hit(
+        soa,
+        [&cone](const float* xs, const float* ys, const float* rs, std::size_t count) {
+            return points_in_cone_batch(cone, xs, ys, rs, count);
+        },
+        fn);
+}
+
 } // namespace raven::systems
@@ -3,10 +3,26 @@
 #include "ecs/components.hpp"
 
 #include <string>
+#include <utility>
 
 namespace raven::systems {
 
-void render_hud(entt::registry& reg, SDL_Renderer* renderer, const BitmapFont& font) {
+namespace {
+
+/// @brief Queue a filled rect.
+void push_fill(std::vector<HudDraw>& out, const SDL_FRect& rect, SDL_Color color) {
+    out.push_back({HudDraw::Kind::Fill, rect, color, {}});
+}
+
+/// @brief Queue a rect outline.
+void push_outline(std::vector<HudDraw>& out, const SDL_FRect& rect, SDL_Color color) {
+    out.push_back({HudDraw::Kind::Outline, rect, color, {}});
+}
+
+} // namespace
+
+void extract_hud(entt::registry& reg, const BitmapFont& font, std::vector<HudDraw>& out) {
+    out.clear();
     constexpr int margin = 4;
 
     // ── Health bar (top-left) ──────────────────────────────────────
@@ -20,8 +36,7 @@ void render_hud(entt::registry& reg, SDL_Renderer* renderer, const BitmapFont& f
         // Background (dark gray)
         SDL_FRect bg{static_cast<float>(hp_bar_x), static_cast<float>(hp_bar_y),
                      static_cast<float>(hp_bar_w), static_cast<float>(hp_bar_h)};
-        SDL_SetRenderDrawColor(renderer, 40, 40, 40, 255);
-        SDL_RenderFillRect(renderer, &bg);
+        push_fill(out, bg, {40, 40, 40, 255});
 
         // Fill (red, or white if invulnerable)
         float ratio = (hp.max > 0.f) ? (hp.current / hp.max) : 0.f;
@@ -32,27 +47,23 @@ void render_hud(entt::registry& reg, SDL_Renderer* renderer, const BitmapFont& f
         int fill_w = static_cast<int>(static_cast<float>(hp_bar_w) * ratio);
 
         bool invulnerable = reg.any_of<Invulnerable>(entity);
-        if (invulnerable) {
-            SDL_SetRenderDrawColor(renderer, 255, 255, 255, 255);
-        } else {
-            SDL_SetRenderDrawColor(renderer, 200, 40, 40, 255);
-        }
+        SDL_Color fill_color =
+            invulnerable ? SDL_Color{255, 255, 255, 255} : SDL_Color{200, 40, 40, 255};
         if (fill_w > 0) {
             SDL_FRect fill{static_cast<float>(hp_bar_x), static_cast<float>(hp_bar_y),
                            static_cast<float>(fill_w), static_cast<float>(hp_bar_h)};
-            SDL_RenderFillRect(renderer, &fill);
+            push_fill(out, fill, fill_color);
         }
 
         // ── Lives pips (right of health bar) ───────────────────────
         constexpr int pip_size = 4;
         constexpr int pip_spacing = 2;
         int pip_x = hp_bar_x + hp_bar_w + margin;
-        SDL_SetRenderDrawColor(renderer, 255, 255, 255, 255);
         for (int i = 0; i < player.lives; ++i) {
             SDL_FRect pip{static_cast<float>(pip_x + i * (pip_size + pip_spacing)),
                           static_cast<float>(hp_bar_y), static_cast<float>(pip_size),
                           static_cast<float>(pip_size)};
-            SDL_RenderFillRect(renderer, &pip);
+            push_fill(out, pip, {255, 255, 255, 255});
         }
 
         // ── Weapon decay timer (below health bar) ─────────────────
@@ -65,8 +76,7 @@ void render_hud(entt::registry& reg, SDL_Renderer* renderer, const BitmapFont& f
             // Background
             SDL_FRect decay_bg{static_cast<float>(decay_x), static_cast<float>(decay_y),
                                static_cast<float>(decay_bar_w), static_cast<float>(decay_bar_h)};
-            SDL_SetRenderDrawColor(renderer, 40, 40, 40, 255);
-            SDL_RenderFillRect(renderer, &decay_bg);
+            push_fill(out, decay_bg, {40, 40, 40, 255});
 
             // Yellow fill
             float decay_ratio = decay->remaining / 10.f;
@@ -79,8 +89,7 @@ void render_hud(entt::registry& reg, SDL_Renderer* renderer, const BitmapFont& f
                 SDL_FRect decay_fill{static_cast<float>(decay_x), static_cast<float>(decay_y),
                                      static_cast<float>(decay_fill_w),
                                      static_cast<float>(decay_bar_h)};
-                SDL_SetRenderDrawColor(renderer, 230, 200, 50, 255);
-                SDL_RenderFillRect(renderer, &decay_fill);
+                push_fill(out, decay_fill, {230, 200, 50, 255});
             }
         }
 
@@ -112,8 +121,7 @@ void render_hud(entt::registry& reg, SDL_Renderer* renderer, const BitmapFont& f
             SDL_FRect ability_bg{
                 static_cast<float>(ability_bar_x), static_cast<float>(ability_bar_y),
                 static_cast<float>(ability_bar_w), static_cast<float>(ability_bar_h)};
-            SDL_SetRenderDrawColor(renderer, 40, 40, 40, 255);
-            SDL_RenderFillRect(renderer, &ability_bg);
+            push_fill(out, ability_bg, {40, 40, 40, 255});
 
             // Cyan fill (ready = full)
             int ability_fill_w =
@@ -123,11 +131,10 @@ void render_hud(entt::registry& reg, SDL_Renderer* renderer, const BitmapFont& f
                     static_cast<float>(ability_bar_x), static_cast<float>(ability_bar_y),
                     static_cast<float>(ability_fill_w), static_cast<float>(ability_bar_h)};
                 if (ability_ratio >= 1.f) {
-                    SDL_SetRenderDrawColor(renderer, 100, 220, 255, 255);
+                    push_fill(out, ability_fill, {100, 220, 255, 255});
                 } else {
-                    SDL_SetRenderDrawColor(renderer, 50, 110, 130, 255);
+                    push_fill(out, ability_fill, {50, 110, 130, 255});
                 }
-                SDL_RenderFillRect(renderer, &ability_fill);
             }
         }
 
@@ -140,8 +147,7 @@ void render_hud(entt::registry& reg, SDL_Renderer* renderer, const BitmapFont& f
             // Background
             SDL_FRect charge_bg{static_cast<float>(margin), static_cast<float>(charge_bar_y),
                                 static_cast<float>(charge_bar_w), static_cast<float>(charge_bar_h)};
-            SDL_SetRenderDrawColor(renderer, 40, 40, 40, 255);
-            SDL_RenderFillRect(renderer, &charge_bg);
+            push_fill(out, charge_bg, {40, 40, 40, 255});
 
             // Orange fill
             float charge = cs->charge;
@@ -153,11 +159,10 @@ void render_hud(entt::registry& reg, SDL_Renderer* renderer, const BitmapFont& f
                                       static_cast<float>(charge_fill_w),
                                       static_cast<float>(charge_bar_h)};
                 if (cs->charge >= cs->full_charge_threshold) {
-                    SDL_SetRenderDrawColor(renderer, 255, 200, 50, 255);
+                    push_fill(out, charge_fill, {255, 200, 50, 255});
                 } else {
-                    SDL_SetRenderDrawColor(renderer, 200, 120, 40, 255);
+                    push_fill(out, charge_fill, {200, 120, 40, 255});
                 }
-                SDL_RenderFillRect(renderer, &charge_fill);
             }
         }
     }
@@ -167,7 +172,8 @@ void render_hud(entt::registry& reg, SDL_Renderer* renderer, const BitmapFont& f
     if (state) {
         std::string score_text = std::to_string(state->score);
         float score_x = static_cast<float>(480 - margin - font.measure(score_text));
-        font.draw(renderer, score_text, score_x, static_cast<float>(margin));
+        out.push_back({HudDraw::Kind::Text, {score_x, static_cast<float>(margin), 0.f, 0.f},
+                       {255, 255, 255, 255}, std::move(score_text)});
 
         // ── Wave indicator (top-center) ────────────────────────────
         int total_waves = state->total_waves;
@@ -184,20 +190,27 @@ void render_hud(entt::registry& reg, SDL_Renderer* renderer, const BitmapFont& f
                               static_cast<float>(dot_size)};
                 if (i < state->current_wave) {
                     // Completed wave — filled bright
-                    SDL_SetRenderDrawColor(renderer, 200, 200, 200, 255);
-                    SDL_RenderFillRect(renderer, &dot);
+                    push_fill(out, dot, {200, 200, 200, 255});
                 } else if (i == state->current_wave && !state->room_cleared) {
                     // Current wave — bright filled
-                    SDL_SetRenderDrawColor(renderer, 255, 255, 100, 255);
-                    SDL_RenderFillRect(renderer, &dot);
+                    push_fill(out, dot, {255, 255, 100, 255});
                 } else {
                     // Remaining — hollow
-                    SDL_SetRenderDrawColor(renderer, 80, 80, 80, 255);
-                    SDL_RenderRect(renderer, &dot);
+                    push_outline(out, dot, {80, 80, 80, 255});
                 }
             }
         }
     }
 }
 
+bool update_hud(entt::registry& reg, const BitmapFont& font, RetainedHud& hud) {
+    extract_hud(reg, font, hud.scratch);
+    if (hud.scratch == hud.items) {
+        return false;
+    }
+    std::swap(hud.items, hud.scratch);
+    ++hud.version;
+    return true;
+}
+
 } // namespace raven::systems
@@ -1,16 +1,37 @@
 #pragma once
 
 #include "rendering/bitmap_font.hpp"
+#include "rendering/render_snapshot.hpp"
 
-#include <SDL3/SDL.h>
 #include <entt/entt.hpp>
 
+#include <cstdint>
+#include <vector>
+
 namespace raven::systems {
 
-/// @brief Render the in-game HUD overlay (health bar, lives, score, decay timer, wave indicator).
+/// @brief Build the in-game HUD overlay (health bar, lives, score, decay timer, wave
+/// indicator) as draw items for a RenderSnapshot.
+/// @param reg The ECS registry containing player and game state.
+/// @param font Bitmap font used to measure text (drawn later from the snapshot).
+/// @param out Cleared and refilled in draw order.
+void extract_hud(entt::registry& reg, const BitmapFont& font, std::vector<HudDraw>& out);
+
+/// @brief The HUD as last published, versioned so the renderer can keep it in a texture.
+struct RetainedHud {
+    std::vector<HudDraw> items;   ///< Current HUD in draw order.
+    std::vector<HudDraw> scratch; ///< This tick's rebuild, adopted when it differs.
+    uint64_t version = 0;         ///< Bumped whenever items change.
+};
+
+/// @brief Rebuild the HUD and bump the version only if anything visible changed.
+///
+/// Health, lives, score and the decay bar change a few times a second at
+/// most, so most ticks end with a cheap comparison and the same version.
 /// @param reg The ECS registry containing player and game state.
-/// @param renderer SDL renderer for drawing primitives.
-/// @param font Bitmap font for text elements (score).
-void render_hud(entt::registry& reg, SDL_Renderer* renderer, const BitmapFont& font);
+/// @param font Bitmap font used to measure text.
+/// @param hud Retained HUD state, updated in place.
+/// @return True if items (and version) changed.
+bool update_hud(entt::registry& reg, const BitmapFont& font, RetainedHud& hud);
 
 } // namespace raven::systems
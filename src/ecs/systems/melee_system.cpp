@@ -6,6 +6,7 @@
 #include "ecs/systems/pickup_system.hpp"
 
 #include <cmath>
+#include <cstddef>
 #include <vector>
 
 namespace raven::systems {
@@ -65,25 +66,35 @@ void update_melee(entt::registry& reg, const InputState& input, const PatternLib
             };
             std::vector<HitInfo> hits;
 
+            // Gather enemy hitboxes once; the cone's aim and cos are computed once
+            CircleSoA targets;
+            std::vector<entt::entity> target_ents;
             for (auto [e_ent, e_tf, e_hb, enemy, e_hp] : enemy_view.each()) {
-                // Use range + enemy hitbox radius for generosity
-                float effective_range = attack.range + e_hb.radius;
-                if (point_in_cone(tf.x, tf.y, attack.aim_x, attack.aim_y, e_tf.x + e_hb.offset_x,
-                                  e_tf.y + e_hb.offset_y, effective_range, attack.half_angle)) {
-                    // Direction away from player for knockback
-                    float dx = e_tf.x - tf.x;
-                    float dy = e_tf.y - tf.y;
-                    float dist = std::sqrt(dx * dx + dy * dy);
-                    float kb_x = 0.f;
-                    float kb_y = 0.f;
-                    if (dist > 0.f) {
-                        kb_x = dx / dist;
-                        kb_y = dy / dist;
-                    }
-                    hits.push_back({e_ent, kb_x, kb_y});
-                }
+                targets.push(e_tf.x + e_hb.offset_x, e_tf.y + e_hb.offset_y, e_hb.radius);
+                target_ents.push_back(e_ent);
             }
 
+            // Reach is range + enemy hitbox radius for generosity
+            auto cone =
+                make_cone(tf.x, tf.y, attack.aim_x, attack.aim_y, attack.range, attack.half_angle);
+            const Transform2D& origin = tf; // older Clang cannot capture structured bindings
+            for_each_hit(targets, cone, [&](std::size_t i) {
+                auto e_ent = target_ents[i];
+
+                // Direction away from player for knockback
+                const auto& e_tf = enemy_view.get<Transform2D>(e_ent);
+                float dx = e_tf.x - origin.x;
+                float dy = e_tf.y - origin.y;
+                float dist = std::sqrt(dx * dx + dy * dy);
+                float kb_x = 0.f;
+                float kb_y = 0.f;
+                if (dist > 0.f) {
+                    kb_x = dx / dist;
+                    kb_y = dy / dist;
+                }
+                hits.push_back({e_ent, kb_x, kb_y});
+            });
+
             for (auto& hit : hits) {
                 auto& e_hp = reg.get<Health>(hit.ent);
                 e_hp.current -= attack.damage;
@@ -95,7 +106,7 @@ void update_melee(entt::registry& reg, const InputState& input, const PatternLib
                 if (auto* emitter = reg.try_get<BulletEmitter>(hit.ent)) {
                     auto* e_tf = reg.try_get<Transform2D>(hit.ent);
                     if (e_tf && emitter->pattern_name.valid()) {
-                        const auto* pattern = patterns.get(interner.resolve(emitter->pattern_name));
+                        const auto* pattern = patterns.resolve(*emitter, interner);
                         if (pattern && !pattern->emitters.empty()) {
                             auto pickup_ent = reg.create();
                             reg.emplace<Transform2D>(pickup_ent, e_tf->x, e_tf->y);
@@ -1,35 +1,67 @@
 #include "ecs/systems/movement_system.hpp"
 
+#include "core/jobs.hpp"
 #include "ecs/components.hpp"
+#include "ecs/systems/bullet_motion.hpp"
+#include "ecs/systems/bullet_pool.hpp"
 #include "rendering/renderer.hpp"
 
 #include <algorithm>
+#include <cstddef>
+#include <cstdint>
 
 namespace raven::systems {
 
 void update_movement(entt::registry& reg, float dt) {
+    constexpr std::size_t GRAIN = 256;
+    JobSystem* jobs = find_jobs(reg);
+
     // Snapshot positions for render interpolation
     auto interp_view = reg.view<Transform2D, PreviousTransform>();
-    for (auto [entity, tf, prev] : interp_view.each()) {
-        prev.x = tf.x;
-        prev.y = tf.y;
-    }
+    parallel_each(jobs, interp_view, GRAIN,
+                  [](entt::entity, const Transform2D& tf, PreviousTransform& prev) {
+                      prev.x = tf.x;
+                      prev.y = tf.y;
+                  });
 
     // Move all entities with velocity
-    auto view = reg.view<Transform2D, Velocity>();
-    for (auto [entity, tf, vel] : view.each()) {
+    auto view = reg.view<Transform2D, Velocity>(entt::exclude<BulletMotion>);
+    parallel_each(jobs, view, GRAIN, [dt](entt::entity, Transform2D& tf, const Velocity& vel) {
         tf.x += vel.dx * dt;
         tf.y += vel.dy * dt;
+    });
+
+    // Closed-form bullets: evaluated from their spawn tick, nothing integrated
+    uint64_t tick = current_sim_tick(reg);
+    auto motion_view = reg.view<Transform2D, Velocity, BulletMotion>();
+    parallel_each(jobs, motion_view, GRAIN,
+                  [tick](entt::entity, Transform2D& tf, Velocity& vel, const BulletMotion& motion) {
+                      auto sample = evaluate_motion(motion, motion_time(motion, tick, 1.f));
+                      tf.x = sample.x;
+                      tf.y = sample.y;
+                      vel.dx = sample.vx;
+                      vel.dy = sample.vy;
+                  });
+
+    // Pooled bullets live outside the registry
+    if (auto* pool = reg.ctx().find<BulletPool>()) {
+        advance_bullet_pool(*pool, tick, jobs);
     }
 
-    // Clamp player to screen bounds
+    // Clamp player to the level (the screen when there is no camera)
+    float bounds_w = static_cast<float>(Renderer::VIRTUAL_WIDTH);
+    float bounds_h = static_cast<float>(Renderer::VIRTUAL_HEIGHT);
+    if (const auto* camera = reg.ctx().find<Camera>()) {
+        bounds_w = camera->world_w;
+        bounds_h = camera->world_h;
+    }
     auto players = reg.view<Transform2D, Player, Sprite>();
     for (auto [entity, tf, player, sprite] : players.each()) {
         float half_w = static_cast<float>(sprite.width) / 2.f;
         float half_h = static_cast<float>(sprite.height) / 2.f;
 
-        tf.x = std::clamp(tf.x, half_w, static_cast<float>(Renderer::VIRTUAL_WIDTH) - half_w);
-        tf.y = std::clamp(tf.y, half_h, static_cast<float>(Renderer::VIRTUAL_HEIGHT) - half_h);
+        tf.x = std::clamp(tf.x, half_w, bounds_w - half_w);
+        tf.y = std::clamp(tf.y, half_h, bounds_h - half_h);
     }
 }
 
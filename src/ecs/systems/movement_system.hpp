@@ -8,7 +8,9 @@ namespace raven::systems {
 ///
 /// Before integration, copies Transform2D into PreviousTransform for
 /// any entity that has both, enabling render interpolation between ticks.
-/// Then applies Velocity to Transform2D and clamps players to screen bounds.
+/// Then applies Velocity to Transform2D and clamps players to the level
+/// bounds held by the Camera in the registry ctx (the screen without one).
+/// Also integrates the BulletPool when one exists in the registry ctx.
 /// @param reg The ECS registry containing entities to update.
 /// @param dt Fixed timestep delta in seconds (typically 1/120).
 void update_movement(entt::registry& reg, float dt);
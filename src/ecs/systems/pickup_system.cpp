@@ -1,5 +1,6 @@
 #include "ecs/systems/pickup_system.hpp"
 
+#include "ecs/command_buffer.hpp"
 #include "ecs/components.hpp"
 #include "ecs/systems/hitbox_math.hpp"
 
@@ -9,7 +10,7 @@ void update_pickups(entt::registry& reg) {
     auto players = reg.view<Transform2D, CircleHitbox, Player, Weapon>();
     auto pickups = reg.view<Transform2D, CircleHitbox, WeaponPickup>();
 
-    std::vector<entt::entity> pickups_to_destroy;
+    DeferredCommands cmds(reg);
 
     for (auto [p_ent, p_tf, p_hb, player, weapon] : players.each()) {
         for (auto [pk_ent, pk_tf, pk_hb, pickup] : pickups.each()) {
@@ -25,21 +26,14 @@ void update_pickups(entt::registry& reg) {
                 reg.emplace_or_replace<WeaponDecay>(p_ent, 10.f);
                 push_sfx(reg, Sfx::Pickup);
 
-                pickups_to_destroy.push_back(pk_ent);
+                cmds->destroy(pk_ent);
                 break; // one pickup per frame
             }
         }
     }
 
-    for (auto pk_ent : pickups_to_destroy) {
-        if (reg.valid(pk_ent)) {
-            reg.destroy(pk_ent);
-        }
-    }
-
     // Stabilizer pickup collection
     auto stabilizers = reg.view<Transform2D, CircleHitbox, StabilizerPickup>();
-    std::vector<entt::entity> stabilizers_to_destroy;
 
     for (auto [p_ent, p_tf, p_hb, player, weapon] : players.each()) {
         if (!reg.any_of<WeaponDecay>(p_ent))
@@ -55,17 +49,11 @@ void update_pickups(entt::registry& reg) {
                     reg.remove<DefaultWeapon>(p_ent);
                 }
                 push_sfx(reg, Sfx::Pickup);
-                stabilizers_to_destroy.push_back(s_ent);
+                cmds->destroy(s_ent);
                 break; // one stabilizer per frame
             }
         }
     }
-
-    for (auto s_ent : stabilizers_to_destroy) {
-        if (reg.valid(s_ent)) {
-            reg.destroy(s_ent);
-        }
-    }
 }
 
 void update_weapon_decay(entt::registry& reg, float dt) {
@@ -2,82 +2,266 @@
 
 #include "core/string_id.hpp"
 #include "ecs/components.hpp"
+#include "ecs/systems/bullet_motion.hpp"
+#include "ecs/systems/bullet_pool.hpp"
 
 #include <algorithm>
-#include <vector>
+#include <cstddef>
+#include <cstdint>
+
+namespace raven::systems {
 
 namespace {
 
-struct RenderEntry {
-    float x, y;
-    int frame_x, frame_y;
-    int width, height;
-    int layer;
-    bool flip_x;
-    float offset_x, offset_y;
-    const raven::SpriteSheet* sheet;
+/// @brief Sheet lookups for one extract; consecutive entries mostly share a sheet.
+class SheetCache {
+  public:
+    SheetCache(const SpriteSheetManager& sprites, const StringInterner& interner)
+        : sprites_(sprites), interner_(interner) {}
+
+    const SpriteSheet* get(StringId id) {
+        if (!primed_ || id != last_id_) {
+            sheet_ = sprites_.get(interner_.resolve(id));
+            last_id_ = id;
+            primed_ = true;
+        }
+        return sheet_;
+    }
+
+  private:
+    const SpriteSheetManager& sprites_;
+    const StringInterner& interner_;
+    StringId last_id_;
+    const SpriteSheet* sheet_ = nullptr;
+    bool primed_ = false;
 };
 
-} // namespace
+/// @brief Draw-order key: placeholders first, then layer, sheet and y.
+bool draws_before(const SpriteOrder::Entry& a, const SpriteOrder::Entry& b) {
+    if ((a.sheet != nullptr) != (b.sheet != nullptr)) {
+        return a.sheet == nullptr;
+    }
+    if (a.layer != b.layer) {
+        return a.layer < b.layer;
+    }
+    if (a.sheet_id != b.sheet_id) {
+        return a.sheet_id < b.sheet_id;
+    }
+    return a.y < b.y;
+}
 
-namespace raven::systems {
+/// @brief Signal hook: queue a new Sprite for the next extract.
+void sprite_added(entt::registry& reg, entt::entity entity) {
+    if (auto* order = reg.ctx().find<SpriteOrder>()) {
+        order->added.push_back(entity);
+    }
+}
 
-void render_sprites(entt::registry& reg, SDL_Renderer* renderer, const SpriteSheetManager& sprites,
-                    float interpolation_alpha) {
-    const auto& interner = reg.ctx().get<StringInterner>();
+/// @brief Signal hook: the next extract drops destroyed entries.
+void sprite_removed(entt::registry& reg, entt::entity /*entity*/) {
+    if (auto* order = reg.ctx().find<SpriteOrder>()) {
+        order->removed = true;
+    }
+}
+
+void connect_sprite_order(entt::registry& reg) {
+    reg.on_construct<Sprite>().connect<&sprite_added>();
+    reg.on_destroy<Sprite>().connect<&sprite_removed>();
+}
+
+void disconnect_sprite_order(entt::registry& reg) {
+    reg.on_construct<Sprite>().disconnect<&sprite_added>();
+    reg.on_destroy<Sprite>().disconnect<&sprite_removed>();
+}
+
+/// @brief Apply queued membership changes, keeping surviving entries in place.
+void sync_members(entt::registry& reg, SpriteOrder& order) {
+    if (!order.removed && order.added.empty()) {
+        return;
+    }
+    const auto& storage = reg.storage<Sprite>();
 
-    // Persistent scratch buffer — cleared each frame, capacity stays allocated
-    auto& entries = reg.ctx().emplace<std::vector<RenderEntry>>();
-    entries.clear();
-
-    auto view = reg.view<Transform2D, Sprite>();
-    for (auto [entity, tf, sprite] : view.each()) {
-        // Interpolate position if previous transform is available
-        float render_x = tf.x;
-        float render_y = tf.y;
-        if (auto* prev = reg.try_get<PreviousTransform>(entity)) {
-            render_x = prev->x + (tf.x - prev->x) * interpolation_alpha;
-            render_y = prev->y + (tf.y - prev->y) * interpolation_alpha;
+    // A sprite removed and emplaced again between extracts is both kept and re-added
+    order.seen.clear();
+    auto keep = [&](entt::entity entity) {
+        if (!storage.contains(entity) || order.seen.contains(entity)) {
+            return false;
+        }
+        order.seen.push(entity);
+        return true;
+    };
+    std::erase_if(order.entries, [&](const auto& entry) { return !keep(entry.entity); });
+    for (auto entity : order.added) {
+        if (keep(entity)) {
+            order.entries.push_back({entity});
         }
+    }
+    order.added.clear();
+    order.removed = false;
+}
 
-        const auto* sheet = sprites.get(interner.resolve(sprite.sheet_id));
-        if (!sheet) {
-            // No sprite sheet loaded — draw a placeholder colored rect
-            SDL_FRect rect{render_x + sprite.offset_x - static_cast<float>(sprite.width) / 2.f,
-                           render_y + sprite.offset_y - static_cast<float>(sprite.height) / 2.f,
-                           static_cast<float>(sprite.width), static_cast<float>(sprite.height)};
-
-            // Color by entity type for debugging
-            if (reg.any_of<Player>(entity)) {
-                SDL_SetRenderDrawColor(renderer, 0, 200, 255, 255);
-            } else if (reg.any_of<Bullet>(entity)) {
-                SDL_SetRenderDrawColor(renderer, 255, 80, 80, 255);
-            } else if (reg.any_of<Enemy>(entity)) {
-                SDL_SetRenderDrawColor(renderer, 200, 50, 200, 255);
-            } else {
-                SDL_SetRenderDrawColor(renderer, 180, 180, 180, 255);
-            }
+/// @brief Refresh an entry's key from its components.
+void update_key(entt::registry& reg, SheetCache& sheets, SpriteOrder::Entry& entry) {
+    const auto& sprite = reg.get<Sprite>(entry.entity);
+    const auto* tf = reg.try_get<Transform2D>(entry.entity);
+    entry.sheet = sheets.get(sprite.sheet_id);
+    entry.layer = sprite.layer;
+    entry.sheet_id = sprite.sheet_id.value;
+    entry.y = tf ? tf->y : 0.f;
+    entry.drawn = tf != nullptr;
+}
 
-            SDL_RenderFillRect(renderer, &rect);
+/// @brief Stable insertion sort; near O(n) when the order barely changed.
+void repair_order(std::vector<SpriteOrder::Entry>& entries) {
+    for (std::size_t i = 1; i < entries.size(); ++i) {
+        if (!draws_before(entries[i], entries[i - 1])) {
             continue;
         }
+        SpriteOrder::Entry entry = entries[i];
+        std::size_t j = i;
+        for (; j > 0 && draws_before(entry, entries[j - 1]); --j) {
+            entries[j] = entries[j - 1];
+        }
+        entries[j] = entry;
+    }
+}
 
-        entries.push_back({render_x, render_y, sprite.frame_x, sprite.frame_y, sprite.width,
-                           sprite.height, sprite.layer, sprite.flip_x, sprite.offset_x,
-                           sprite.offset_y, sheet});
+/// @brief Build the draw item for one sorted entry.
+SpriteDraw make_item(entt::registry& reg, const SpriteOrder::Entry& entry, uint64_t tick) {
+    const auto entity = entry.entity;
+    const auto& tf = reg.get<Transform2D>(entity);
+    const auto& sprite = reg.get<Sprite>(entity);
+
+    SpriteDraw item;
+    item.x = tf.x;
+    item.y = tf.y;
+    item.prev_x = tf.x;
+    item.prev_y = tf.y;
+    if (const auto* motion = reg.try_get<BulletMotion>(entity)) {
+        auto from = evaluate_motion(*motion, motion_time(*motion, tick, 0.f));
+        auto to = evaluate_motion(*motion, motion_time(*motion, tick, 1.f));
+        item.prev_x = from.x;
+        item.prev_y = from.y;
+        item.x = to.x;
+        item.y = to.y;
+    } else if (const auto* prev = reg.try_get<PreviousTransform>(entity)) {
+        item.prev_x = prev->x;
+        item.prev_y = prev->y;
     }
 
-    // Sort by layer (lower layers drawn first)
-    std::sort(entries.begin(), entries.end(),
-              [](const RenderEntry& a, const RenderEntry& b) { return a.layer < b.layer; });
+    item.sheet = entry.sheet;
+    item.offset_x = sprite.offset_x;
+    item.offset_y = sprite.offset_y;
+    item.frame_x = sprite.frame_x;
+    item.frame_y = sprite.frame_y;
+    item.width = sprite.width;
+    item.height = sprite.height;
+    item.layer = sprite.layer;
+    item.flip_x = sprite.flip_x;
 
-    // Draw
-    for (const auto& e : entries) {
-        e.sheet->draw(renderer, e.frame_x, e.frame_y,
-                      static_cast<int>(e.x + e.offset_x - static_cast<float>(e.width) / 2.f),
-                      static_cast<int>(e.y + e.offset_y - static_cast<float>(e.height) / 2.f),
-                      e.width, e.height, e.flip_x);
+    if (!item.sheet) {
+        // No sprite sheet loaded — color the placeholder by entity type
+        if (reg.any_of<Player>(entity)) {
+            item.placeholder = {0, 200, 255, 255};
+        } else if (reg.any_of<Bullet>(entity)) {
+            item.placeholder = {255, 80, 80, 255};
+        } else if (reg.any_of<Enemy>(entity)) {
+            item.placeholder = {200, 50, 200, 255};
+        } else {
+            item.placeholder = {180, 180, 180, 255};
+        }
     }
+    return item;
+}
+
+} // namespace
+
+void enable_sprite_order(entt::registry& reg) {
+    reg.ctx().erase<SpriteOrder>();
+    auto& order = reg.ctx().emplace<SpriteOrder>();
+    for (auto entity : reg.view<Sprite>()) {
+        order.added.push_back(entity);
+    }
+
+    // Disconnect first so re-entering a scene does not double the hooks
+    disconnect_sprite_order(reg);
+    connect_sprite_order(reg);
+}
+
+void disable_sprite_order(entt::registry& reg) {
+    disconnect_sprite_order(reg);
+    reg.ctx().erase<SpriteOrder>();
+}
+
+void extract_sprites(entt::registry& reg, const SpriteSheetManager& sprites,
+                     std::vector<SpriteDraw>& out) {
+    const auto& interner = reg.ctx().get<StringInterner>();
+    out.clear();
+
+    // Closed-form bullets are sampled at both ends of the last tick
+    uint64_t tick = current_sim_tick(reg);
+
+    SheetCache sheets(sprites, interner);
+    if (auto* order = reg.ctx().find<SpriteOrder>()) {
+        sync_members(reg, *order);
+        for (auto& entry : order->entries) {
+            update_key(reg, sheets, entry);
+        }
+        repair_order(order->entries);
+        for (const auto& entry : order->entries) {
+            if (entry.drawn) {
+                out.push_back(make_item(reg, entry, tick));
+            }
+        }
+    } else {
+        std::vector<SpriteOrder::Entry> entries;
+        for (auto entity : reg.view<Transform2D, Sprite>()) {
+            entries.push_back({entity});
+            update_key(reg, sheets, entries.back());
+        }
+        std::stable_sort(entries.begin(), entries.end(), draws_before);
+        for (const auto& entry : entries) {
+            out.push_back(make_item(reg, entry, tick));
+        }
+    }
+
+    // Pooled bullets (no entities) go on the bullet layer
+    const auto* pool = reg.ctx().find<BulletPool>();
+    if (!pool || pool->size() == 0) {
+        return;
+    }
+    const auto entity_items = static_cast<std::ptrdiff_t>(out.size());
+    for (std::size_t i = 0; i < pool->size(); ++i) {
+        const auto& sprite = pool->sprite[i];
+        const auto& motion = pool->motion[i];
+
+        auto from = evaluate_motion(motion, motion_time(motion, tick, 0.f));
+        auto to = evaluate_motion(motion, motion_time(motion, tick, 1.f));
+        SpriteDraw item;
+        item.sheet = sheets.get(sprite.sheet_id);
+        item.prev_x = from.x;
+        item.prev_y = from.y;
+        item.x = to.x;
+        item.y = to.y;
+        item.frame_x = sprite.frame_x;
+        item.frame_y = sprite.frame_y;
+        item.width = sprite.width;
+        item.height = sprite.height;
+        item.layer = 5;
+        item.placeholder = {255, 80, 80, 255};
+        out.push_back(item);
+    }
+
+    // Bullets share one layer, so splitting off placeholders sorts them; a
+    // linear merge then slots them in after entities of the same key
+    auto mid = out.begin() + entity_items;
+    std::stable_partition(mid, out.end(), [](const SpriteDraw& d) { return d.sheet == nullptr; });
+    std::inplace_merge(out.begin(), mid, out.end(), [](const SpriteDraw& a, const SpriteDraw& b) {
+        if ((a.sheet != nullptr) != (b.sheet != nullptr)) {
+            return a.sheet == nullptr;
+        }
+        return a.layer < b.layer;
+    });
 }
 
 } // namespace raven::systems
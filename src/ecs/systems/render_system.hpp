@@ -1,23 +1,67 @@
 #pragma once
 
+#include "rendering/render_snapshot.hpp"
 #include "rendering/sprite_sheet.hpp"
 
-#include <SDL3/SDL.h>
 #include <entt/entt.hpp>
 
+#include <cstdint>
+#include <vector>
+
 namespace raven::systems {
 
-/// @brief Render all entities that have Sprite and Transform2D components.
+/// @brief Persistent draw order of Sprite entities, kept across frames.
+///
+/// When present in the registry ctx, Sprite construct/destroy signals record
+/// membership changes and extract_sprites repairs the previous frame's order
+/// with an insertion sort instead of sorting from scratch. Sprites rarely
+/// change layer or sheet and move a few pixels per tick, so the repair is
+/// close to linear, and equal keys keep their relative order, so sprites
+/// sharing a layer, sheet and y never swap between frames.
+///
+/// Without it (unit tests, other scenes) extract_sprites stable-sorts the
+/// view every call with the same key.
+struct SpriteOrder {
+    /// @brief One Sprite entity and its sort key from the last extract.
+    struct Entry {
+        entt::entity entity = entt::null;
+        const SpriteSheet* sheet = nullptr; ///< Null draws a placeholder (sorted first).
+        int layer = 0;
+        uint16_t sheet_id = 0; ///< StringId::value; groups draws by texture.
+        float y = 0.f;         ///< Depth within a layer and sheet.
+        bool drawn = false;    ///< Has a Transform2D this frame.
+    };
+
+    std::vector<Entry> entries;      ///< Draw order.
+    std::vector<entt::entity> added; ///< Constructed since the last extract.
+    bool removed = false;            ///< A Sprite was destroyed since the last extract.
+    entt::sparse_set seen;           ///< Scratch for dropping duplicate entries.
+};
+
+/// @brief Install SpriteOrder in the ctx and hook the Sprite signals.
+///
+/// Sprites that already exist are queued as if just constructed.
+/// @param reg The ECS registry.
+void enable_sprite_order(entt::registry& reg);
+
+/// @brief Remove SpriteOrder and disconnect the Sprite signals.
+/// @param reg The ECS registry.
+void disable_sprite_order(entt::registry& reg);
+
+/// @brief Collect every entity with Sprite and Transform2D (and every pooled
+/// bullet) as draw items for a RenderSnapshot.
 ///
-/// Sorts entities by Sprite::layer before drawing so higher layers
-/// render on top. Reads Transform2D for position and Sprite for the
-/// sheet ID and frame indices. Entities with PreviousTransform are
-/// interpolated between ticks using the supplied alpha.
+/// Each item carries both interpolation endpoints: PreviousTransform and
+/// Transform2D for integrated entities, the closed-form position at the
+/// start and end of the tick for BulletMotion and pooled bullets. Items are
+/// ordered by Sprite::layer, then sheet, then y, after the placeholder rects
+/// of entities whose sheet is not loaded; pooled bullets are merged in after
+/// entities of the same layer. Runs on the simulation side; touches no SDL
+/// state.
 /// @param reg The ECS registry containing renderable entities.
-/// @param renderer The SDL_Renderer to draw with.
-/// @param sprites The SpriteSheetManager providing loaded textures.
-/// @param interpolation_alpha Blend factor [0,1] between previous and current tick positions.
-void render_sprites(entt::registry& reg, SDL_Renderer* renderer, const SpriteSheetManager& sprites,
-                    float interpolation_alpha);
+/// @param sprites The SpriteSheetManager providing loaded sheets.
+/// @param out Cleared and refilled; capacity is kept.
+void extract_sprites(entt::registry& reg, const SpriteSheetManager& sprites,
+                     std::vector<SpriteDraw>& out);
 
 } // namespace raven::systems
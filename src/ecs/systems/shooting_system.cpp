@@ -2,15 +2,16 @@
 
 #include "ecs/components.hpp"
 #include "ecs/systems/bullet_spawn.hpp"
+#include "patterns/burst_table.hpp"
 
 #include <cmath>
+#include <cstddef>
 
 namespace raven::systems {
 
 namespace {
 
 constexpr float AIM_DEADZONE = 0.2f;
-constexpr float PI = 3.14159265358979323846f;
 
 } // namespace
 
@@ -21,6 +22,14 @@ void update_shooting(entt::registry& reg, const InputState& input, float dt) {
         cd.remaining -= dt;
     }
 
+    // Mouse is in virtual-screen pixels; the camera view it sits on maps it to world
+    float view_x = 0.f;
+    float view_y = 0.f;
+    if (const auto* camera = reg.ctx().find<Camera>()) {
+        view_x = camera->x;
+        view_y = camera->y;
+    }
+
     // Resolve aim direction
     auto aim_view = reg.view<Player, Transform2D, AimDirection>();
     for (auto [entity, player, tf, aim] : aim_view.each()) {
@@ -30,8 +39,8 @@ void update_shooting(entt::registry& reg, const InputState& input, float dt) {
             aim.x = input.aim_x * inv_len;
             aim.y = input.aim_y * inv_len;
         } else if (input.mouse_active) {
-            float dx = input.mouse_x - tf.x;
-            float dy = input.mouse_y - tf.y;
+            float dx = input.mouse_x + view_x - tf.x;
+            float dy = input.mouse_y + view_y - tf.y;
             float len = std::sqrt(dx * dx + dy * dy);
             if (len > 1.f) {
                 aim.x = dx / len;
@@ -53,6 +62,7 @@ void update_shooting(entt::registry& reg, const InputState& input, float dt) {
 
             float base_angle = std::atan2(aim.y, aim.x);
 
+            // AimDirection is already a unit vector: use it as the center
             BulletSpawnParams params;
             params.origin_x = tf.x;
             params.origin_y = tf.y;
@@ -67,19 +77,25 @@ void update_shooting(entt::registry& reg, const InputState& input, float dt) {
             params.width = weapon.bullet_width;
             params.height = weapon.bullet_height;
             params.piercing = weapon.piercing;
+            params.has_dir = true;
 
             if (weapon.bullet_count <= 1) {
                 params.angle_rad = base_angle;
+                params.dir_x = aim.x;
+                params.dir_y = aim.y;
                 spawn_bullet(reg, params);
             } else {
-                float spread_rad = weapon.spread_angle * PI / 180.f;
-                float step = spread_rad / static_cast<float>(weapon.bullet_count);
-                float start = base_angle - spread_rad / 2.f;
+                const auto& table = reg.ctx().emplace<BurstTableCache>().get(
+                    weapon.bullet_count, weapon.spread_angle);
 
-                for (int i = 0; i < weapon.bullet_count; ++i) {
-                    params.angle_rad = start + step * static_cast<float>(i) + step / 2.f;
-                    spawn_bullet(reg, params);
+                auto& spread = reg.ctx().emplace<BulletSpawnScratch>().params;
+                spread.clear();
+                for (std::size_t i = 0; i < table.size(); ++i) {
+                    params.angle_rad = base_angle + table.angle_off[i];
+                    table.rotate(i, aim.x, aim.y, params.dir_x, params.dir_y);
+                    spread.push_back(params);
                 }
+                spawn_bullets(reg, spread);
             }
         }
     }
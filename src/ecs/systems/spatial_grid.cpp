@@ -0,0 +1,72 @@
+#include "ecs/systems/spatial_grid.hpp"
+
+#include <algorithm>
+#include <cmath>
+
+namespace raven::systems {
+
+void SpatialGrid::reset(float width, float height, float cell_size) {
+    cell_size_ = cell_size > 0.f ? cell_size : DEFAULT_CELL_SIZE;
+    inv_cell_size_ = 1.f / cell_size_;
+    cols_ = std::max(1, static_cast<int>(std::ceil(width * inv_cell_size_)));
+    rows_ = std::max(1, static_cast<int>(std::ceil(height * inv_cell_size_)));
+    cells_.assign(static_cast<size_t>(cols_ * rows_), {});
+}
+
+void SpatialGrid::clear() {
+    for (auto& cell : cells_) {
+        cell.clear();
+    }
+}
+
+int SpatialGrid::col_of(float x) const {
+    // Clamp in float space first: casting a huge or NaN float to int is UB
+    float c = std::clamp(std::floor(x * inv_cell_size_), 0.f, static_cast<float>(cols_ - 1));
+    return static_cast<int>(c);
+}
+
+int SpatialGrid::row_of(float y) const {
+    float r = std::clamp(std::floor(y * inv_cell_size_), 0.f, static_cast<float>(rows_ - 1));
+    return static_cast<int>(r);
+}
+
+void SpatialGrid::insert(uint32_t id, float x, float y, float radius) {
+    int min_c = col_of(x - radius);
+    int max_c = col_of(x + radius);
+    int min_r = row_of(y - radius);
+    int max_r = row_of(y + radius);
+
+    for (int r = min_r; r <= max_r; ++r) {
+        for (int c = min_c; c <= max_c; ++c) {
+            cells_[static_cast<size_t>(r * cols_ + c)].push_back(id);
+        }
+    }
+}
+
+void SpatialGrid::query(float x, float y, float radius, std::vector<uint32_t>& out) const {
+    out.clear();
+    if (!configured()) {
+        return;
+    }
+
+    int min_c = col_of(x - radius);
+    int max_c = col_of(x + radius);
+    int min_r = row_of(y - radius);
+    int max_r = row_of(y + radius);
+
+    for (int r = min_r; r <= max_r; ++r) {
+        for (int c = min_c; c <= max_c; ++c) {
+            const auto& cell = cells_[static_cast<size_t>(r * cols_ + c)];
+            out.insert(out.end(), cell.begin(), cell.end());
+        }
+    }
+
+    // Circles spanning several cells appear once per cell; restore the
+    // insertion (view) order so narrow-phase "first hit" matches brute force
+    if (min_c != max_c || min_r != max_r) {
+        std::sort(out.begin(), out.end());
+        out.erase(std::unique(out.begin(), out.end()), out.end());
+    }
+}
+
+} // namespace raven::systems
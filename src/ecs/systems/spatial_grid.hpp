@@ -0,0 +1,88 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace raven::systems {
+
+/// @brief Uniform-grid spatial hash for circle broad-phase queries.
+///
+/// Covers a fixed rectangle (the level or the 480x270 virtual area) with
+/// square cells. Each circle is inserted into every cell its bounding box
+/// touches, so large hitboxes (e.g. the 18px boss circle) are found from
+/// any neighbouring cell. Positions outside the bounds clamp to the edge
+/// cells — insertion and query clamp identically, so nothing is missed.
+///
+/// Ids are caller-chosen indices. query() returns them sorted ascending and
+/// deduplicated; callers that insert in view iteration order therefore get
+/// candidates back in that same order, which keeps narrow-phase results
+/// identical to a brute-force scan.
+///
+/// Cell vectors keep their capacity across clear(), so rebuilding the grid
+/// every tick does not allocate once the high-water mark is reached.
+class SpatialGrid {
+  public:
+    static constexpr float DEFAULT_CELL_SIZE = 32.f; ///< Cell edge in pixels.
+
+    /// @brief Set the covered area and cell size, discarding all entries.
+    /// @param width Covered width in pixels (origin at 0,0).
+    /// @param height Covered height in pixels.
+    /// @param cell_size Cell edge in pixels (> 0).
+    void reset(float width, float height, float cell_size = DEFAULT_CELL_SIZE);
+
+    /// @brief Remove all entries, keeping bounds and cell capacity.
+    void clear();
+
+    /// @brief Insert a circle into every cell its bounding box overlaps.
+    /// @param id Caller-chosen identifier returned by query().
+    /// @param x Circle centre X in world pixels.
+    /// @param y Circle centre Y in world pixels.
+    /// @param radius Circle radius in pixels.
+    void insert(uint32_t id, float x, float y, float radius);
+
+    /// @brief Collect ids whose cells overlap a circle's bounding box.
+    ///
+    /// This is a conservative broad-phase: every inserted circle that
+    /// overlaps the query circle is returned, plus possibly some that don't.
+    /// @param x Query centre X in world pixels.
+    /// @param y Query centre Y in world pixels.
+    /// @param radius Query radius in pixels.
+    /// @param out Cleared, then filled with sorted, unique candidate ids.
+    void query(float x, float y, float radius, std::vector<uint32_t>& out) const;
+
+    /// @brief Whether reset() has been called with a usable size.
+    [[nodiscard]] bool configured() const { return cols_ > 0 && rows_ > 0; }
+
+    /// @brief Number of cell columns.
+    [[nodiscard]] int cols() const { return cols_; }
+
+    /// @brief Number of cell rows.
+    [[nodiscard]] int rows() const { return rows_; }
+
+    /// @brief Cell edge length in pixels.
+    [[nodiscard]] float cell_size() const { return cell_size_; }
+
+    /// @brief Ids stored in a single cell (for tests and debug drawing).
+    /// @param col Column index, must be in [0, cols()).
+    /// @param row Row index, must be in [0, rows()).
+    /// @return The cell's ids in insertion order.
+    [[nodiscard]] const std::vector<uint32_t>& cell(int col, int row) const {
+        return cells_[static_cast<size_t>(row * cols_ + col)];
+    }
+
+  private:
+    std::vector<std::vector<uint32_t>> cells_; ///< Row-major cell buckets.
+    float cell_size_ = DEFAULT_CELL_SIZE;
+    float inv_cell_size_ = 1.f / DEFAULT_CELL_SIZE;
+    int cols_ = 0;
+    int rows_ = 0;
+
+    /// @brief Clamped column index for a world X coordinate.
+    [[nodiscard]] int col_of(float x) const;
+
+    /// @brief Clamped row index for a world Y coordinate.
+    [[nodiscard]] int row_of(float y) const;
+};
+
+} // namespace raven::systems
@@ -1,28 +1,60 @@
 #include "ecs/systems/tilemap_render_system.hpp"
 
+#include <algorithm>
+
 namespace raven::systems {
 
-void render_tilemap(const Tilemap& tilemap, SDL_Renderer* renderer) {
-    if (!tilemap.is_loaded() || !tilemap.texture()) {
+void extract_tiles(const Tilemap& tilemap, uint64_t revision, const SDL_FRect& view,
+                   RenderSnapshot& snapshot) {
+    // One chunk of margin covers the camera's interpolation between ticks
+    const SDL_Rect chunks = tilemap.chunks_in(view, 1);
+    if (snapshot.tiles_revision == revision && snapshot.tiles_chunks.x == chunks.x &&
+        snapshot.tiles_chunks.y == chunks.y && snapshot.tiles_chunks.w == chunks.w &&
+        snapshot.tiles_chunks.h == chunks.h) {
+        return;
+    }
+    snapshot.tiles_revision = revision;
+    snapshot.tiles_chunks = chunks;
+    snapshot.tiles.clear();
+
+    if (!tilemap.is_loaded() || !tilemap.texture() || chunks.w == 0 || chunks.h == 0) {
+        return;
+    }
+
+    // A baked room is one quad cut to the chunks in range
+    if (SDL_Texture* room = tilemap.room_texture()) {
+        const int size = tilemap.chunk_size_px();
+        const int x = chunks.x * size;
+        const int y = chunks.y * size;
+        const SDL_FRect rect{static_cast<float>(x), static_cast<float>(y),
+                             static_cast<float>(std::min(chunks.w * size, tilemap.width_px() - x)),
+                             static_cast<float>(std::min(chunks.h * size, tilemap.height_px() - y))};
+        snapshot.tiles.push_back({room, rect, rect, SDL_FLIP_NONE});
         return;
     }
 
     SDL_Texture* tex = tilemap.texture();
-    for (const auto& tile : tilemap.tiles()) {
-        SDL_FRect dest{static_cast<float>(tile.dest_x), static_cast<float>(tile.dest_y),
-                       static_cast<float>(tile.src.w), static_cast<float>(tile.src.h)};
+    const SDL_Point origin = tilemap.texture_origin();
+    for (int cy = chunks.y; cy < chunks.y + chunks.h; ++cy) {
+        for (int cx = chunks.x; cx < chunks.x + chunks.w; ++cx) {
+            for (const auto& tile : tilemap.chunk_tiles(cx, cy)) {
+                TileDraw item;
+                item.texture = tex;
+                item.dest = {static_cast<float>(tile.dest_x), static_cast<float>(tile.dest_y),
+                             static_cast<float>(tile.src.w), static_cast<float>(tile.src.h)};
+                item.src = {static_cast<float>(origin.x + tile.src.x),
+                            static_cast<float>(origin.y + tile.src.y),
+                            static_cast<float>(tile.src.w), static_cast<float>(tile.src.h)};
 
-        SDL_FlipMode flip = SDL_FLIP_NONE;
-        if (tile.flip_x) {
-            flip = static_cast<SDL_FlipMode>(flip | SDL_FLIP_HORIZONTAL);
+                if (tile.flip_x) {
+                    item.flip = static_cast<SDL_FlipMode>(item.flip | SDL_FLIP_HORIZONTAL);
+                }
+                if (tile.flip_y) {
+                    item.flip = static_cast<SDL_FlipMode>(item.flip | SDL_FLIP_VERTICAL);
+                }
+                snapshot.tiles.push_back(item);
+            }
         }
-        if (tile.flip_y) {
-            flip = static_cast<SDL_FlipMode>(flip | SDL_FLIP_VERTICAL);
-        }
-
-        SDL_FRect src{static_cast<float>(tile.src.x), static_cast<float>(tile.src.y),
-                      static_cast<float>(tile.src.w), static_cast<float>(tile.src.h)};
-        SDL_RenderTextureRotated(renderer, tex, &src, &dest, 0.0, nullptr, flip);
     }
 }
 
@@ -1,14 +1,24 @@
 #pragma once
 
+#include "rendering/render_snapshot.hpp"
 #include "rendering/tilemap.hpp"
 
-#include <SDL3/SDL.h>
+#include <cstdint>
 
 namespace raven::systems {
 
-/// @brief Render all pre-baked tiles from a loaded tilemap.
-/// @param tilemap The tilemap to render.
-/// @param renderer The SDL_Renderer to draw with.
-void render_tilemap(const Tilemap& tilemap, SDL_Renderer* renderer);
+/// @brief Copy the tiles of the chunks around @p view into a snapshot.
+///
+/// Only chunks overlapping the view, plus one chunk of margin, are copied,
+/// so the cost follows the screen size rather than the level size. The copy
+/// is skipped while the snapshot already holds @p revision and the same
+/// chunk range. A baked tilemap (see Tilemap::bake()) yields one quad
+/// covering that range.
+/// @param tilemap The tilemap to extract.
+/// @param revision Load counter of the tilemap (bumped by the owner on reload).
+/// @param view Camera view in world pixels.
+/// @param snapshot Snapshot whose tiles, tiles_revision and tiles_chunks are updated.
+void extract_tiles(const Tilemap& tilemap, uint64_t revision, const SDL_FRect& view,
+                   RenderSnapshot& snapshot);
 
 } // namespace raven::systems
@@ -1,5 +1,6 @@
 #include "ecs/systems/wave_system.hpp"
 
+#include "core/asset_pack.hpp"
 #include "core/paths.hpp"
 #include "core/string_id.hpp"
 #include "ecs/systems/hitbox_math.hpp"
@@ -8,7 +9,6 @@
 #include <spdlog/spdlog.h>
 
 #include <algorithm>
-#include <fstream>
 
 namespace raven {
 
@@ -113,14 +113,12 @@ EnemyVisuals enemy_visuals(Enemy::Type type) {
 // ── StageLoader ────────────────────────────────────────────────────
 
 bool StageLoader::load_manifest(const std::string& manifest_path) {
-    std::ifstream file(manifest_path);
-    if (!file.is_open()) {
-        spdlog::warn("Stage manifest '{}' not found", manifest_path);
-        return false;
-    }
-
     try {
-        auto j = nlohmann::json::parse(file);
+        nlohmann::json j;
+        if (!assets::load_json(manifest_path, j)) {
+            spdlog::warn("Stage manifest '{}' not found", manifest_path);
+            return false;
+        }
         int loaded = 0;
         for (const auto& path : j.at("stages")) {
             // Manifest entries are relative to the install dir, not the CWD
@@ -137,14 +135,12 @@ bool StageLoader::load_manifest(const std::string& manifest_path) {
 }
 
 bool StageLoader::load_file(const std::string& file_path) {
-    std::ifstream file(file_path);
-    if (!file.is_open()) {
-        spdlog::error("Failed to open stage file '{}'", file_path);
-        return false;
-    }
-
     try {
-        auto j = nlohmann::json::parse(file);
+        nlohmann::json j;
+        if (!assets::load_json(file_path, j)) {
+            spdlog::error("Failed to open stage file '{}'", file_path);
+            return false;
+        }
         stages_.push_back(parse_stage(j));
         spdlog::debug("Loaded stage '{}'", stages_.back().name);
         return true;
@@ -248,8 +244,9 @@ void spawn_wave(entt::registry& reg, const Tilemap& tilemap, const StageDef& sta
         reg.emplace<ScoreValue>(enemy, def.score);
 
         // Set up bullet emitter if a pattern exists
-        if (patterns.get(def.pattern)) {
-            reg.emplace<BulletEmitter>(enemy, BulletEmitter{interner.intern(def.pattern), {}, {}});
+        if (auto pattern_id = patterns.id(def.pattern); pattern_id.valid()) {
+            reg.emplace<BulletEmitter>(
+                enemy, BulletEmitter{interner.intern(def.pattern), {}, {}, true, pattern_id});
         }
 
         reg.emplace<AiBehavior>(enemy, make_ai(def.ai));
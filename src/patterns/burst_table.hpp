@@ -0,0 +1,97 @@
+#pragma once
+
+#include <cmath>
+#include <cstddef>
+#include <vector>
+
+namespace raven {
+
+/// @brief Unit-vector offsets of an evenly spread burst, relative to its center.
+///
+/// Built once per (count, spread) pair. Firing a burst is then one cos/sin of
+/// the center angle and a complex multiply per bullet, instead of a cos/sin
+/// per bullet. Bullet i sits at the middle of the i-th of @c count equal
+/// slices of the spread arc, matching the layout of the old per-bullet loop.
+struct BurstTable {
+    std::vector<float> cos_off;   ///< cos of each bullet's offset from center.
+    std::vector<float> sin_off;   ///< sin of each bullet's offset from center.
+    std::vector<float> angle_off; ///< Offset from center in radians.
+    int count = 0;                ///< Bullets per burst the table was built for.
+    float spread_deg = 0.f;       ///< Arc width in degrees the table was built for.
+
+    /// @brief Rebuild the table.
+    /// @param bullets Bullets per burst (values below 1 build a single center entry).
+    /// @param spread Arc width in degrees.
+    void build(int bullets, float spread) {
+        constexpr float DEG_TO_RAD = 3.14159265358979323846f / 180.f;
+
+        count = bullets;
+        spread_deg = spread;
+        cos_off.clear();
+        sin_off.clear();
+        angle_off.clear();
+
+        if (bullets <= 1) {
+            cos_off.push_back(1.f);
+            sin_off.push_back(0.f);
+            angle_off.push_back(0.f);
+            return;
+        }
+
+        float spread_rad = spread * DEG_TO_RAD;
+        float step = spread_rad / static_cast<float>(bullets);
+        float start = -spread_rad / 2.f + step / 2.f;
+        for (int i = 0; i < bullets; ++i) {
+            float off = start + step * static_cast<float>(i);
+            cos_off.push_back(std::cos(off));
+            sin_off.push_back(std::sin(off));
+            angle_off.push_back(off);
+        }
+    }
+
+    /// @brief Whether the table was built for the given burst shape.
+    [[nodiscard]] bool matches(int bullets, float spread) const {
+        return !cos_off.empty() && count == bullets && spread_deg == spread;
+    }
+
+    /// @brief Number of directions in the table.
+    [[nodiscard]] std::size_t size() const { return cos_off.size(); }
+
+    /// @brief Rotate offset @p i by a center direction (complex multiply).
+    /// @param i Table index.
+    /// @param cx cos of the center angle.
+    /// @param cy sin of the center angle.
+    /// @param out_x Receives the unit direction X.
+    /// @param out_y Receives the unit direction Y.
+    void rotate(std::size_t i, float cx, float cy, float& out_x, float& out_y) const {
+        out_x = cx * cos_off[i] - cy * sin_off[i];
+        out_y = cy * cos_off[i] + cx * sin_off[i];
+    }
+};
+
+/// @brief Small cache of BurstTables keyed by (count, spread).
+///
+/// For burst shapes that are not fixed at load time, such as the player's
+/// current Weapon. Weapons change rarely, so a linear scan over a handful
+/// of entries is enough.
+class BurstTableCache {
+  public:
+    /// @brief Get (building if needed) the table for a burst shape.
+    /// @param bullets Bullets per burst.
+    /// @param spread Arc width in degrees.
+    const BurstTable& get(int bullets, float spread) {
+        for (const auto& table : tables_) {
+            if (table.matches(bullets, spread)) {
+                return table;
+            }
+        }
+        auto& table = tables_.emplace_back();
+        table.build(bullets, spread);
+        return table;
+    }
+
+  private:
+    std::vector<BurstTable> tables_;
+};
+
+} // namespace raven
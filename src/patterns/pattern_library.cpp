@@ -1,11 +1,11 @@
 #include "patterns/pattern_library.hpp"
 
+#include "core/asset_pack.hpp"
 #include "core/paths.hpp"
 
 #include <spdlog/spdlog.h>
 
 #include <algorithm>
-#include <fstream>
 
 namespace raven {
 
@@ -30,14 +30,12 @@ bool PatternLibrary::load_manifest(const std::string& manifest_path) {
         spdlog::error("PatternLibrary: set_interner() must be called before loading");
         return false;
     }
-    std::ifstream f(manifest_path);
-    if (!f.is_open()) {
-        spdlog::warn("Pattern manifest '{}' not found", manifest_path);
-        return false;
-    }
-
     try {
-        auto j = nlohmann::json::parse(f);
+        nlohmann::json j;
+        if (!assets::load_json(manifest_path, j)) {
+            spdlog::warn("Pattern manifest '{}' not found", manifest_path);
+            return false;
+        }
         int count = 0;
         for (const auto& path : j.at("patterns")) {
             // Manifest entries are relative to the install dir, not the CWD
@@ -58,18 +56,17 @@ bool PatternLibrary::load_file(const std::string& file_path) {
         spdlog::error("PatternLibrary: set_interner() must be called before loading");
         return false;
     }
-    std::ifstream f(file_path);
-    if (!f.is_open()) {
-        spdlog::error("Failed to open pattern file '{}'", file_path);
-        return false;
-    }
-
     try {
-        auto j = nlohmann::json::parse(f);
-        auto pattern = parse_pattern(j);
-        auto name = pattern.name;
-        patterns_[name] = std::move(pattern);
-        spdlog::debug("Loaded pattern '{}'", name);
+        nlohmann::json j;
+        if (!assets::load_json(file_path, j)) {
+            spdlog::error("Failed to open pattern file '{}'", file_path);
+            return false;
+        }
+        auto id = store(parse_pattern(j));
+        if (!id.valid()) {
+            return false;
+        }
+        spdlog::debug("Loaded pattern '{}'", names_[id.value]);
         return true;
     } catch (const nlohmann::json::exception& e) {
         spdlog::error("Failed to parse pattern '{}': {}", file_path, e.what());
@@ -83,10 +80,11 @@ bool PatternLibrary::load_from_json(const nlohmann::json& j) {
         return false;
     }
     try {
-        auto pattern = parse_pattern(j);
-        auto name = pattern.name;
-        patterns_[name] = std::move(pattern);
-        spdlog::debug("Loaded pattern '{}' from JSON", name);
+        auto id = store(parse_pattern(j));
+        if (!id.valid()) {
+            return false;
+        }
+        spdlog::debug("Loaded pattern '{}' from JSON", names_[id.value]);
         return true;
     } catch (const nlohmann::json::exception& e) {
         spdlog::error("Failed to parse pattern from JSON: {}", e.what());
@@ -94,18 +92,49 @@ bool PatternLibrary::load_from_json(const nlohmann::json& j) {
     }
 }
 
+PatternId PatternLibrary::store(PatternDef pattern) {
+    auto [it, inserted] = ids_.try_emplace(pattern.name);
+    if (inserted) {
+        if (patterns_.size() >= std::size_t{PatternId::MAX}) {
+            spdlog::error("Cannot load pattern '{}': all {} pattern ids are in use", pattern.name,
+                          PatternId::MAX);
+            ids_.erase(it);
+            return PatternId{};
+        }
+        it->second = PatternId{static_cast<uint16_t>(patterns_.size())};
+        names_.push_back(pattern.name);
+        patterns_.push_back(std::move(pattern));
+    } else {
+        patterns_[it->second.value] = std::move(pattern);
+    }
+    return it->second;
+}
+
 const PatternDef* PatternLibrary::get(const std::string& name) const {
-    auto it = patterns_.find(name);
-    return it != patterns_.end() ? &it->second : nullptr;
+    return get(id(name));
 }
 
-std::vector<std::string> PatternLibrary::names() const {
-    std::vector<std::string> result;
-    result.reserve(patterns_.size());
-    for (const auto& [name, _] : patterns_) {
-        result.push_back(name);
+PatternId PatternLibrary::id(const std::string& name) const {
+    auto it = ids_.find(name);
+    return it != ids_.end() ? it->second : PatternId{};
+}
+
+const PatternDef* PatternLibrary::resolve(BulletEmitter& emitter,
+                                          const StringInterner& interner) const {
+    if (!emitter.pattern_id.resolved()) {
+        const auto& name = interner.resolve(emitter.pattern_name);
+        emitter.pattern_id = id(name);
+        if (!emitter.pattern_id.valid()) {
+            // Remember the miss so the name is not hashed again every tick
+            spdlog::warn("Emitter pattern '{}' is not loaded", name);
+            emitter.pattern_id = PatternId{PatternId::MISSING};
+        }
     }
-    return result;
+    return get(emitter.pattern_id);
+}
+
+std::vector<std::string> PatternLibrary::names() const {
+    return names_;
 }
 
 PatternDef PatternLibrary::parse_pattern(const nlohmann::json& j) const {
@@ -158,6 +187,14 @@ EmitterDef PatternLibrary::parse_emitter(const nlohmann::json& j,
     def.damage = j.value("damage", 1.f);
     def.hitbox_radius =
         clamp_field(pattern_name, "hitbox_radius", j.value("hitbox_radius", 3.f), 0.f, 64.f);
+    def.bullet_angular_velocity = clamp_field(pattern_name, "bullet_angular_velocity",
+                                              j.value("bullet_angular_velocity", 0.f), -720.f,
+                                              720.f);
+    def.bullet_acceleration = clamp_field(
+        pattern_name, "bullet_acceleration", j.value("bullet_acceleration", 0.f), -1000.f, 1000.f);
+
+    // count and spread are fixed from here on: bake the burst directions
+    def.burst.build(def.count, def.spread_angle);
 
     return def;
 }
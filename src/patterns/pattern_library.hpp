@@ -1,9 +1,12 @@
 #pragma once
 
 #include "ecs/components.hpp"
+#include "patterns/burst_table.hpp"
 
 #include <nlohmann/json.hpp>
 
+#include <cstddef>
+#include <span>
 #include <string>
 #include <unordered_map>
 #include <vector>
@@ -22,21 +25,24 @@ struct EmitterDef {
         Linear  ///< Bullets fired in a straight line.
     };
 
-    Type type = Type::Radial;     ///< Emission shape.
-    int count = 1;                ///< Bullets per burst.
-    float speed = 100.f;          ///< Bullet speed in pixels/sec.
-    float angular_velocity = 0.f; ///< Emitter rotation in degrees/sec.
-    float fire_rate = 0.1f;       ///< Seconds between bursts.
-    float spread_angle = 360.f;   ///< Arc width in degrees.
-    float start_angle = 0.f;      ///< Initial angle offset in degrees.
-    StringId bullet_sheet;        ///< Interned sprite sheet ID for emitted bullets.
-    int bullet_frame_x = 0;       ///< Frame column in the sheet.
-    int bullet_frame_y = 0;       ///< Frame row in the sheet.
-    int bullet_width = 8;         ///< Pixel width of bullet frame.
-    int bullet_height = 8;        ///< Pixel height of bullet frame.
-    float lifetime = 5.f;         ///< Bullet lifetime in seconds.
-    float damage = 1.f;           ///< Damage dealt per bullet on contact.
-    float hitbox_radius = 3.f;    ///< Bullet collision radius in pixels.
+    Type type = Type::Radial;            ///< Emission shape.
+    int count = 1;                       ///< Bullets per burst.
+    float speed = 100.f;                 ///< Bullet speed in pixels/sec.
+    float angular_velocity = 0.f;        ///< Emitter rotation in degrees/sec.
+    float fire_rate = 0.1f;              ///< Seconds between bursts.
+    float spread_angle = 360.f;          ///< Arc width in degrees.
+    float start_angle = 0.f;             ///< Initial angle offset in degrees.
+    StringId bullet_sheet;               ///< Interned sprite sheet ID for emitted bullets.
+    int bullet_frame_x = 0;              ///< Frame column in the sheet.
+    int bullet_frame_y = 0;              ///< Frame row in the sheet.
+    int bullet_width = 8;                ///< Pixel width of bullet frame.
+    int bullet_height = 8;               ///< Pixel height of bullet frame.
+    float lifetime = 5.f;                ///< Bullet lifetime in seconds.
+    float damage = 1.f;                  ///< Damage dealt per bullet on contact.
+    float hitbox_radius = 3.f;           ///< Bullet collision radius in pixels.
+    float bullet_angular_velocity = 0.f; ///< Bullet heading change in degrees/sec (curving).
+    float bullet_acceleration = 0.f;     ///< Bullet speed change in pixels/sec^2.
+    BurstTable burst;                    ///< Per-bullet direction offsets (built at load).
 };
 
 /// @brief A complete bullet pattern composed of one or more emitters.
@@ -47,6 +53,10 @@ struct PatternDef {
 };
 
 /// @brief Loads and stores bullet pattern definitions from JSON files.
+///
+/// Patterns are stored densely and addressed by PatternId, assigned in load
+/// order. The name map is only consulted to resolve an id once; per-tick
+/// lookups index the array directly.
 class PatternLibrary {
   public:
     /// @brief Load a manifest JSON that lists pattern files to load.
@@ -69,18 +79,52 @@ class PatternLibrary {
     /// @return Pointer to the PatternDef, or nullptr if not found.
     [[nodiscard]] const PatternDef* get(const std::string& name) const;
 
+    /// @brief Retrieve a pattern by id (array index, no hashing).
+    /// @param id A PatternId returned by id().
+    /// @return Pointer to the PatternDef, or nullptr if the id is invalid.
+    [[nodiscard]] const PatternDef* get(PatternId id) const {
+        return id.value < patterns_.size() ? &patterns_[id.value] : nullptr;
+    }
+
+    /// @brief Look up the dense id of a pattern.
+    /// @param name The pattern identifier.
+    /// @return The PatternId, or an invalid id if not loaded.
+    [[nodiscard]] PatternId id(const std::string& name) const;
+
+    /// @brief Resolve an emitter's pattern, caching its PatternId on first use.
+    ///
+    /// A name that is not loaded is logged once and cached as
+    /// PatternId::MISSING, so later calls return nullptr without a lookup.
+    /// @param emitter The emitter (pattern_id is filled in from pattern_name).
+    /// @param interner Interner that produced emitter.pattern_name.
+    /// @return Pointer to the PatternDef, or nullptr if not loaded.
+    const PatternDef* resolve(BulletEmitter& emitter, const StringInterner& interner) const;
+
     /// @brief Get the names of all loaded patterns.
     /// @return Vector of pattern name strings.
     [[nodiscard]] std::vector<std::string> names() const;
 
+    /// @brief Names of all loaded patterns, indexed by PatternId (no allocation).
+    /// @return View valid until the next load.
+    [[nodiscard]] std::span<const std::string> names_view() const { return names_; }
+
+    /// @brief Number of loaded patterns.
+    [[nodiscard]] std::size_t size() const { return patterns_.size(); }
+
     /// @brief Set the string interner used for bullet_sheet fields during parsing.
     /// @param interner The StringInterner to use. Must outlive the library.
     void set_interner(StringInterner& interner) { interner_ = &interner; }
 
   private:
-    std::unordered_map<std::string, PatternDef> patterns_;
+    std::vector<PatternDef> patterns_;               ///< Indexed by PatternId.
+    std::vector<std::string> names_;                 ///< Indexed by PatternId.
+    std::unordered_map<std::string, PatternId> ids_; ///< Name to id.
     StringInterner* interner_ = nullptr;
 
+    /// @brief Insert or replace a pattern, keeping the id of an existing name.
+    /// @return The id, or an invalid id (logged) once PatternId::MAX are in use.
+    PatternId store(PatternDef pattern);
+
     PatternDef parse_pattern(const nlohmann::json& j) const;
     EmitterDef parse_emitter(const nlohmann::json& j, const std::string& pattern_name) const;
 };
@@ -1,93 +1,234 @@
 #include "rendering/bitmap_font.hpp"
 
-#include <SDL3_image/SDL_image.h>
+#include "core/asset_pack.hpp"
+
 #include <spdlog/spdlog.h>
 
+#include <algorithm>
+#include <functional>
 #include <utility>
 
 namespace raven {
 
 BitmapFont::~BitmapFont() {
-    if (texture_) {
+    if (texture_ && owns_texture_) {
         SDL_DestroyTexture(texture_);
     }
 }
 
 BitmapFont::BitmapFont(BitmapFont&& other) noexcept
-    : texture_(std::exchange(other.texture_, nullptr)), glyph_w_(std::exchange(other.glyph_w_, 0)),
-      glyph_h_(std::exchange(other.glyph_h_, 0)) {}
+    : texture_(std::exchange(other.texture_, nullptr)),
+      owns_texture_(std::exchange(other.owns_texture_, true)),
+      origin_x_(std::exchange(other.origin_x_, 0)), origin_y_(std::exchange(other.origin_y_, 0)),
+      glyph_w_(std::exchange(other.glyph_w_, 0)), glyph_h_(std::exchange(other.glyph_h_, 0)),
+      runs_(std::move(other.runs_)), run_clock_(other.run_clock_) {
+    other.runs_.clear();
+}
 
 BitmapFont& BitmapFont::operator=(BitmapFont&& other) noexcept {
     if (this != &other) {
-        if (texture_) {
+        if (texture_ && owns_texture_) {
             SDL_DestroyTexture(texture_);
         }
         texture_ = std::exchange(other.texture_, nullptr);
+        owns_texture_ = std::exchange(other.owns_texture_, true);
+        origin_x_ = std::exchange(other.origin_x_, 0);
+        origin_y_ = std::exchange(other.origin_y_, 0);
         glyph_w_ = std::exchange(other.glyph_w_, 0);
         glyph_h_ = std::exchange(other.glyph_h_, 0);
+        runs_ = std::move(other.runs_);
+        run_clock_ = other.run_clock_;
+        other.runs_.clear();
     }
     return *this;
 }
 
 bool BitmapFont::load(SDL_Renderer* renderer, const std::string& path, int glyph_w, int glyph_h) {
-    SDL_Surface* surface = IMG_Load(path.c_str());
+    SDL_Surface* surface = assets::load_surface(path);
     if (!surface) {
         spdlog::error("Failed to load font atlas '{}': {}", path, SDL_GetError());
         return false;
     }
 
-    SDL_Texture* texture = SDL_CreateTextureFromSurface(renderer, surface);
     int sheet_w = surface->w;
     int sheet_h = surface->h;
+    bool created = create(renderer, surface, glyph_w, glyph_h);
     SDL_DestroySurface(surface);
 
-    if (!texture) {
+    if (!created) {
         spdlog::error("Failed to create font texture from '{}': {}", path, SDL_GetError());
         return false;
     }
 
-    if (texture_) {
+    spdlog::debug("Loaded font atlas '{}': {}x{}, glyph cell {}x{}", path, sheet_w, sheet_h,
+                  glyph_w_, glyph_h_);
+    return true;
+}
+
+bool BitmapFont::create(SDL_Renderer* renderer, SDL_Surface* surface, int glyph_w, int glyph_h) {
+    SDL_Texture* texture = SDL_CreateTextureFromSurface(renderer, surface);
+    if (!texture) {
+        return false;
+    }
+
+    if (texture_ && owns_texture_) {
         SDL_DestroyTexture(texture_);
     }
     texture_ = texture;
+    owns_texture_ = true;
+    origin_x_ = 0;
+    origin_y_ = 0;
+    clear_runs();
 
     SDL_SetTextureBlendMode(texture_, SDL_BLENDMODE_BLEND);
     SDL_SetTextureScaleMode(texture_, SDL_SCALEMODE_PIXELART);
 
     glyph_w_ = glyph_w;
     glyph_h_ = glyph_h;
-
-    spdlog::debug("Loaded font atlas '{}': {}x{}, glyph cell {}x{}", path, sheet_w, sheet_h,
-                  glyph_w_, glyph_h_);
     return true;
 }
 
+void BitmapFont::attach(const AtlasRegion& region, int glyph_w, int glyph_h) {
+    if (texture_ && owns_texture_) {
+        SDL_DestroyTexture(texture_);
+    }
+    texture_ = region.texture;
+    owns_texture_ = false;
+    origin_x_ = region.rect.x;
+    origin_y_ = region.rect.y;
+    glyph_w_ = glyph_w;
+    glyph_h_ = glyph_h;
+    clear_runs();
+}
+
+void BitmapFont::clear_runs() {
+    runs_.clear();
+}
+
+SDL_FRect BitmapFont::glyph_rect(char c) const {
+    int idx = font_glyph_index(c);
+    if (idx < 0) {
+        idx = font_glyph_index('?');
+    }
+    return {static_cast<float>(origin_x_ + (idx % COLUMNS) * glyph_w_),
+            static_cast<float>(origin_y_ + (idx / COLUMNS) * glyph_h_),
+            static_cast<float>(glyph_w_), static_cast<float>(glyph_h_)};
+}
+
+BitmapFont::TextRun& BitmapFont::run(std::string_view text, SDL_Color color, int scale) const {
+    // Hash collisions are caught by comparing the stored key
+    uint64_t key = std::hash<std::string_view>{}(text);
+    const uint64_t rgba = (static_cast<uint64_t>(color.r) << 24) |
+                          (static_cast<uint64_t>(color.g) << 16) |
+                          (static_cast<uint64_t>(color.b) << 8) | static_cast<uint64_t>(color.a);
+    const uint64_t extra = (static_cast<uint64_t>(scale) << 32) | rgba;
+    key ^= extra + 0x9e3779b97f4a7c15ULL + (key << 6) + (key >> 2);
+
+    auto it = runs_.find(key);
+    if (it != runs_.end() && it->second.text == text && it->second.scale == scale &&
+        it->second.color.r == color.r && it->second.color.g == color.g &&
+        it->second.color.b == color.b && it->second.color.a == color.a) {
+        it->second.last_used = ++run_clock_;
+        return it->second;
+    }
+
+    if (it == runs_.end() && runs_.size() >= MAX_RUNS) {
+        auto oldest =
+            std::min_element(runs_.begin(), runs_.end(), [](const auto& a, const auto& b) {
+                return a.second.last_used < b.second.last_used;
+            });
+        runs_.erase(oldest);
+    }
+
+    TextRun& entry = runs_[key];
+    entry.text.assign(text);
+    entry.scale = scale;
+    entry.color = color;
+    entry.glyphs.clear();
+    entry.vertices.clear();
+    entry.last_used = ++run_clock_;
+
+    const float advance = static_cast<float>(glyph_w_ * scale);
+    float pen_x = 0.f;
+    for (char c : text) {
+        if (c != ' ') {
+            entry.glyphs.push_back({glyph_rect(c), pen_x});
+        }
+        pen_x += advance;
+    }
+    return entry;
+}
+
+void BitmapFont::build_vertices(TextRun& run) const {
+    float tex_w = 0.f;
+    float tex_h = 0.f;
+    SDL_GetTextureSize(texture_, &tex_w, &tex_h);
+    const float inv_w = tex_w > 0.f ? 1.f / tex_w : 0.f;
+    const float inv_h = tex_h > 0.f ? 1.f / tex_h : 0.f;
+
+    constexpr float INV_255 = 1.f / 255.f;
+    const SDL_FColor color{static_cast<float>(run.color.r) * INV_255,
+                           static_cast<float>(run.color.g) * INV_255,
+                           static_cast<float>(run.color.b) * INV_255,
+                           static_cast<float>(run.color.a) * INV_255};
+    const float w = static_cast<float>(glyph_w_ * run.scale);
+    const float h = static_cast<float>(glyph_h_ * run.scale);
+
+    run.vertices.clear();
+    for (const auto& g : run.glyphs) {
+        const float u0 = g.src.x * inv_w;
+        const float v0 = g.src.y * inv_h;
+        const float u1 = (g.src.x + g.src.w) * inv_w;
+        const float v1 = (g.src.y + g.src.h) * inv_h;
+        run.vertices.push_back({{g.x, 0.f}, color, {u0, v0}});
+        run.vertices.push_back({{g.x + w, 0.f}, color, {u1, v0}});
+        run.vertices.push_back({{g.x + w, h}, color, {u1, v1}});
+        run.vertices.push_back({{g.x, h}, color, {u0, v1}});
+    }
+}
+
 void BitmapFont::draw(SDL_Renderer* renderer, std::string_view text, float x, float y,
                       SDL_Color color, int scale) const {
     if (!texture_ || text.empty() || scale < 1) {
         return;
     }
 
-    SDL_SetTextureColorMod(texture_, color.r, color.g, color.b);
-    SDL_SetTextureAlphaMod(texture_, color.a);
+    TextRun& cached = run(text, color, scale);
+    if (cached.glyphs.empty()) {
+        return;
+    }
+    if (cached.vertices.empty()) {
+        build_vertices(cached);
+    }
+
+    // Same layout as RenderQueue: four vertices per glyph, two triangles
+    const size_t index_count = cached.glyphs.size() * 6;
+    for (auto base = static_cast<int>(indices_.size() / 6 * 4); indices_.size() < index_count;
+         base += 4) {
+        for (int k : {0, 1, 2, 0, 2, 3}) {
+            indices_.push_back(base + k);
+        }
+    }
+
+    vertices_.assign(cached.vertices.begin(), cached.vertices.end());
+    for (auto& v : vertices_) {
+        v.position.x += x;
+        v.position.y += y;
+    }
+    SDL_RenderGeometry(renderer, texture_, vertices_.data(), static_cast<int>(vertices_.size()),
+                       indices_.data(), static_cast<int>(index_count));
+}
+
+void BitmapFont::push(RenderQueue& queue, int layer, std::string_view text, float x, float y,
+                      SDL_Color color, int scale) const {
+    if (!texture_ || text.empty() || scale < 1) {
+        return;
+    }
 
     const float w = static_cast<float>(glyph_w_ * scale);
     const float h = static_cast<float>(glyph_h_ * scale);
-    float pen_x = x;
-
-    for (char c : text) {
-        int idx = font_glyph_index(c);
-        if (idx < 0) {
-            idx = font_glyph_index('?');
-        }
-        if (c != ' ') {
-            SDL_FRect src{static_cast<float>((idx % COLUMNS) * glyph_w_),
-                          static_cast<float>((idx / COLUMNS) * glyph_h_),
-                          static_cast<float>(glyph_w_), static_cast<float>(glyph_h_)};
-            SDL_FRect dst{pen_x, y, w, h};
-            SDL_RenderTexture(renderer, texture_, &src, &dst);
-        }
-        pen_x += w;
+    for (const auto& g : run(text, color, scale).glyphs) {
+        queue.push(layer, texture_, g.src, {x + g.x, y, w, h}, color);
     }
 }
 
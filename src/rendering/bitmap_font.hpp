@@ -1,9 +1,15 @@
 #pragma once
 
+#include "rendering/render_queue.hpp"
+#include "rendering/texture_atlas.hpp"
+
 #include <SDL3/SDL.h>
 
+#include <cstdint>
 #include <string>
 #include <string_view>
+#include <unordered_map>
+#include <vector>
 
 namespace raven {
 
@@ -23,14 +29,19 @@ namespace raven {
 
 /// @brief Monospace bitmap font renderer backed by a glyph atlas texture.
 ///
-/// Glyphs are white in the atlas; draw() tints them per call via SDL
-/// color modulation. All drawing is unloaded-safe: a font that failed to
+/// Glyphs are white in the atlas and tinted through vertex colours. Menus
+/// and the HUD redraw the same strings every frame, so the glyph layout of
+/// each (text, scale, colour) is cached as a text run: a repeated string
+/// costs a hash lookup plus one translated geometry submission. The cache
+/// holds the MAX_RUNS most recently used runs and is dropped whenever the
+/// glyph atlas changes. All drawing is unloaded-safe: a font that failed to
 /// load simply draws nothing, matching the sprite fallback philosophy.
 class BitmapFont {
   public:
-    static constexpr int FIRST_CHAR = 32; ///< First ASCII code in the atlas.
-    static constexpr int LAST_CHAR = 126; ///< Last ASCII code in the atlas.
-    static constexpr int COLUMNS = 16;    ///< Glyphs per atlas row.
+    static constexpr int FIRST_CHAR = 32;  ///< First ASCII code in the atlas.
+    static constexpr int LAST_CHAR = 126;  ///< Last ASCII code in the atlas.
+    static constexpr int COLUMNS = 16;     ///< Glyphs per atlas row.
+    static constexpr size_t MAX_RUNS = 64; ///< Cached text runs before evicting.
 
     BitmapFont() = default;
     ~BitmapFont();
@@ -48,6 +59,20 @@ class BitmapFont {
     /// @return True on success.
     bool load(SDL_Renderer* renderer, const std::string& path, int glyph_w, int glyph_h);
 
+    /// @brief Create the atlas texture from an image decoded elsewhere.
+    /// @param renderer The SDL renderer that will own the texture.
+    /// @param surface Decoded atlas; the caller keeps ownership.
+    /// @param glyph_w Cell width in pixels, including spacing.
+    /// @param glyph_h Cell height in pixels, including spacing.
+    /// @return True on success.
+    bool create(SDL_Renderer* renderer, SDL_Surface* surface, int glyph_w, int glyph_h);
+
+    /// @brief Draw glyphs from a region of a shared atlas page.
+    /// @param region Where the atlas image was packed (see TextureAtlas::add()).
+    /// @param glyph_w Cell width in pixels, including spacing.
+    /// @param glyph_h Cell height in pixels, including spacing.
+    void attach(const AtlasRegion& region, int glyph_w, int glyph_h);
+
     /// @brief Whether the atlas texture is loaded and drawable.
     /// @return True if load() succeeded.
     [[nodiscard]] bool is_loaded() const { return texture_ != nullptr; }
@@ -68,7 +93,7 @@ class BitmapFont {
         return static_cast<int>(text.size()) * glyph_w_ * scale;
     }
 
-    /// @brief Draw text with its top-left corner at (x, y).
+    /// @brief Draw text with its top-left corner at (x, y) in one geometry call.
     /// @param renderer The SDL renderer to draw with.
     /// @param text The text to draw; characters outside the atlas draw '?'.
     /// @param x Left edge in virtual-resolution pixels.
@@ -78,6 +103,17 @@ class BitmapFont {
     void draw(SDL_Renderer* renderer, std::string_view text, float x, float y,
               SDL_Color color = {255, 255, 255, 255}, int scale = 1) const;
 
+    /// @brief Queue text with its top-left corner at (x, y) (see RenderQueue).
+    /// @param queue Queue to push the run's glyph quads into.
+    /// @param layer Draw order within the queue.
+    /// @param text The text to draw; characters outside the atlas draw '?'.
+    /// @param x Left edge in virtual-resolution pixels.
+    /// @param y Top edge in virtual-resolution pixels.
+    /// @param color Tint color, applied per vertex.
+    /// @param scale Integer pixel scale factor.
+    void push(RenderQueue& queue, int layer, std::string_view text, float x, float y,
+              SDL_Color color = {255, 255, 255, 255}, int scale = 1) const;
+
     /// @brief Draw text horizontally centered on center_x.
     /// @param renderer The SDL renderer to draw with.
     /// @param text The text to draw.
@@ -88,10 +124,54 @@ class BitmapFont {
     void draw_centered(SDL_Renderer* renderer, std::string_view text, float center_x, float y,
                        SDL_Color color = {255, 255, 255, 255}, int scale = 1) const;
 
+    /// @brief Texture the glyphs are drawn from (an atlas page once attached).
+    [[nodiscard]] SDL_Texture* texture() const { return texture_; }
+
+    /// @brief Source rect of a glyph in texture(), atlas offset included.
+    /// @param c Character; those outside the atlas map to '?'.
+    [[nodiscard]] SDL_FRect glyph_rect(char c) const;
+
+    /// @brief Text runs currently cached.
+    [[nodiscard]] size_t cached_runs() const { return runs_.size(); }
+
   private:
+    /// @brief One visible glyph of a run.
+    struct Glyph {
+        SDL_FRect src; ///< Texel rect in texture_.
+        float x;       ///< Left edge relative to the run's origin.
+    };
+
+    /// @brief Laid-out glyphs of one string at one scale and colour.
+    struct TextRun {
+        std::string text;
+        int scale = 1;
+        SDL_Color color{};
+        std::vector<Glyph> glyphs;        ///< Spaces are skipped.
+        std::vector<SDL_Vertex> vertices; ///< Relative to (0, 0); built on first draw().
+        uint64_t last_used = 0;
+    };
+
+    /// @brief Cached run for the arguments, laid out on a miss.
+    TextRun& run(std::string_view text, SDL_Color color, int scale) const;
+
+    /// @brief Fill run.vertices from run.glyphs (needs the texture size for UVs).
+    void build_vertices(TextRun& run) const;
+
+    /// @brief Forget every run; glyph rects change with the atlas.
+    void clear_runs();
+
     SDL_Texture* texture_ = nullptr;
+    bool owns_texture_ = true; ///< False when texture_ is a borrowed atlas page.
+    int origin_x_ = 0;         ///< Atlas image's top-left in texture_.
+    int origin_y_ = 0;
     int glyph_w_ = 0;
     int glyph_h_ = 0;
+
+    // Caching does not change what a const font draws
+    mutable std::unordered_map<uint64_t, TextRun> runs_;
+    mutable uint64_t run_clock_ = 0;           ///< Stamps TextRun::last_used.
+    mutable std::vector<SDL_Vertex> vertices_; ///< Scratch: a run moved into place.
+    mutable std::vector<int> indices_;         ///< Quad indices, shared by every run.
 };
 
 } // namespace raven
@@ -0,0 +1,105 @@
+#include "rendering/debug_draw.hpp"
+
+#include <cmath>
+#include <numbers>
+
+namespace raven {
+
+void DebugDraw::line(float x0, float y0, float x1, float y1, SDL_Color color) {
+    float dx = x1 - x0;
+    float dy = y1 - y0;
+    float len = std::sqrt(dx * dx + dy * dy);
+    if (len <= 0.f) {
+        // Still visible as a one-pixel dot
+        dx = 1.f;
+        dy = 0.f;
+        len = 1.f;
+    }
+
+    // Half a pixel either side of the segment
+    const float nx = -dy / len * 0.5f;
+    const float ny = dx / len * 0.5f;
+
+    constexpr float INV_255 = 1.f / 255.f;
+    const SDL_FColor fc{static_cast<float>(color.r) * INV_255,
+                        static_cast<float>(color.g) * INV_255,
+                        static_cast<float>(color.b) * INV_255,
+                        static_cast<float>(color.a) * INV_255};
+
+    const int base = static_cast<int>(vertices_.size());
+    vertices_.push_back({{x0 + nx, y0 + ny}, fc, {0.f, 0.f}});
+    vertices_.push_back({{x1 + nx, y1 + ny}, fc, {0.f, 0.f}});
+    vertices_.push_back({{x1 - nx, y1 - ny}, fc, {0.f, 0.f}});
+    vertices_.push_back({{x0 - nx, y0 - ny}, fc, {0.f, 0.f}});
+    for (int k : {0, 1, 2, 0, 2, 3}) {
+        indices_.push_back(base + k);
+    }
+}
+
+void DebugDraw::rect(const SDL_FRect& bounds, SDL_Color color) {
+    const float x0 = bounds.x;
+    const float y0 = bounds.y;
+    const float x1 = bounds.x + bounds.w;
+    const float y1 = bounds.y + bounds.h;
+    line(x0, y0, x1, y0, color);
+    line(x1, y0, x1, y1, color);
+    line(x1, y1, x0, y1, color);
+    line(x0, y1, x0, y0, color);
+}
+
+void DebugDraw::circle(float cx, float cy, float radius, SDL_Color color, int sides) {
+    if (sides < 3) {
+        sides = 3;
+    }
+    const float step = 2.f * std::numbers::pi_v<float> / static_cast<float>(sides);
+    float px = cx + radius;
+    float py = cy;
+    for (int i = 1; i <= sides; ++i) {
+        const float a = step * static_cast<float>(i);
+        const float x = cx + std::cos(a) * radius;
+        const float y = cy + std::sin(a) * radius;
+        line(px, py, x, y, color);
+        px = x;
+        py = y;
+    }
+}
+
+void DebugDraw::cone(float cx, float cy, float dir_x, float dir_y, float range, float half_angle,
+                     SDL_Color color) {
+    const float axis = std::atan2(dir_y, dir_x);
+    const float start = axis - half_angle;
+    const float step = 2.f * half_angle / static_cast<float>(CONE_SEGMENTS);
+
+    float px = cx + std::cos(start) * range;
+    float py = cy + std::sin(start) * range;
+    line(cx, cy, px, py, color);
+    for (int i = 1; i <= CONE_SEGMENTS; ++i) {
+        const float a = start + step * static_cast<float>(i);
+        const float x = cx + std::cos(a) * range;
+        const float y = cy + std::sin(a) * range;
+        line(px, py, x, y, color);
+        px = x;
+        py = y;
+    }
+    line(px, py, cx, cy, color);
+}
+
+void DebugDraw::clear() {
+    vertices_.clear();
+    indices_.clear();
+}
+
+void DebugDraw::draw(SDL_Renderer* renderer, float offset_x, float offset_y) const {
+    if (vertices_.empty()) {
+        return;
+    }
+    moved_.assign(vertices_.begin(), vertices_.end());
+    for (auto& v : moved_) {
+        v.position.x -= offset_x;
+        v.position.y -= offset_y;
+    }
+    SDL_RenderGeometry(renderer, nullptr, moved_.data(), static_cast<int>(moved_.size()),
+                       indices_.data(), static_cast<int>(indices_.size()));
+}
+
+} // namespace raven
@@ -0,0 +1,65 @@
+#pragma once
+
+#include <SDL3/SDL.h>
+
+#include <cstddef>
+#include <vector>
+
+namespace raven {
+
+/// @brief Immediate-mode debug shapes batched into one vertex buffer.
+///
+/// Every shape is broken into one-pixel line segments, and each segment
+/// becomes a thin untextured quad with its colour in the vertices. A whole
+/// frame of hitboxes, cones and rays therefore goes out in a single
+/// SDL_RenderGeometry call, however many shapes there are. Shapes are
+/// recorded in world pixels and offset by the camera when drawn. Recording
+/// touches no SDL state, so the simulation can fill one for a RenderSnapshot.
+class DebugDraw {
+  public:
+    static constexpr int CIRCLE_SEGMENTS = 16; ///< Segments per circle outline.
+    static constexpr int CONE_SEGMENTS = 8;    ///< Segments along a cone's arc.
+
+    /// @brief Record a line segment.
+    void line(float x0, float y0, float x1, float y1, SDL_Color color);
+
+    /// @brief Record a rectangle outline.
+    void rect(const SDL_FRect& bounds, SDL_Color color);
+
+    /// @brief Record a circle outline.
+    /// @param sides Polygon sides; small hitboxes look round enough with fewer.
+    void circle(float cx, float cy, float radius, SDL_Color color, int sides = CIRCLE_SEGMENTS);
+
+    /// @brief Record a cone (circular sector) outline.
+    /// @param cx Apex X.
+    /// @param cy Apex Y.
+    /// @param dir_x Axis direction X (need not be normalised).
+    /// @param dir_y Axis direction Y.
+    /// @param range Radius of the arc.
+    /// @param half_angle Half of the opening angle in radians.
+    /// @param color Outline colour.
+    void cone(float cx, float cy, float dir_x, float dir_y, float range, float half_angle,
+              SDL_Color color);
+
+    /// @brief Forget every recorded shape, keeping capacity.
+    void clear();
+
+    /// @brief Line segments recorded since the last clear().
+    [[nodiscard]] size_t segments() const { return vertices_.size() / 4; }
+
+    /// @brief Whether nothing is recorded.
+    [[nodiscard]] bool empty() const { return vertices_.empty(); }
+
+    /// @brief Submit every segment with one SDL_RenderGeometry call.
+    /// @param renderer The SDL renderer to draw with.
+    /// @param offset_x Subtracted from X (camera left edge).
+    /// @param offset_y Subtracted from Y (camera top edge).
+    void draw(SDL_Renderer* renderer, float offset_x, float offset_y) const;
+
+  private:
+    std::vector<SDL_Vertex> vertices_;      ///< Four per segment, in world pixels.
+    std::vector<int> indices_;              ///< Six per segment.
+    mutable std::vector<SDL_Vertex> moved_; ///< Scratch: vertices offset by the camera.
+};
+
+} // namespace raven
@@ -0,0 +1,88 @@
+#include "rendering/hud_layer.hpp"
+
+#include <spdlog/spdlog.h>
+
+namespace raven {
+
+HudLayer::HudLayer(int width, int height) : width_(width), height_(height) {}
+
+HudLayer::~HudLayer() {
+    if (texture_) {
+        SDL_DestroyTexture(texture_);
+    }
+}
+
+void HudLayer::draw(SDL_Renderer* renderer, RenderQueue& queue, const BitmapFont& font,
+                    const std::vector<HudDraw>& items, uint64_t version) {
+    if (items.empty()) {
+        return;
+    }
+    if (!valid_ || version != version_) {
+        valid_ = redraw(renderer, font, items);
+        version_ = version;
+    }
+    if (!valid_) {
+        push_hud(queue, font, items, RenderQueue::LAYER_HUD);
+        return;
+    }
+
+    const SDL_FRect rect{0.f, 0.f, static_cast<float>(width_), static_cast<float>(height_)};
+    queue.push(RenderQueue::LAYER_HUD, texture_, rect, rect);
+}
+
+bool HudLayer::redraw(SDL_Renderer* renderer, const BitmapFont& font,
+                      const std::vector<HudDraw>& items) {
+    if (!renderer || disabled_) {
+        return false;
+    }
+
+    if (!texture_) {
+        texture_ = SDL_CreateTexture(renderer, SDL_PIXELFORMAT_RGBA32, SDL_TEXTUREACCESS_TARGET,
+                                     width_, height_);
+        if (!texture_) {
+            spdlog::warn("Failed to create HUD texture, drawing it directly: {}", SDL_GetError());
+            disabled_ = true;
+            return false;
+        }
+        // Blending onto transparent black leaves premultiplied colour
+        SDL_SetTextureBlendMode(texture_, SDL_BLENDMODE_BLEND_PREMULTIPLIED);
+        SDL_SetTextureScaleMode(texture_, SDL_SCALEMODE_PIXELART);
+    }
+
+    SDL_Texture* previous = SDL_GetRenderTarget(renderer);
+    if (!SDL_SetRenderTarget(renderer, texture_)) {
+        spdlog::warn("Failed to draw into HUD texture, drawing it directly: {}", SDL_GetError());
+        SDL_DestroyTexture(texture_);
+        texture_ = nullptr;
+        disabled_ = true;
+        return false;
+    }
+    SDL_SetRenderDrawColor(renderer, 0, 0, 0, 0);
+    SDL_RenderClear(renderer);
+
+    push_hud(queue_, font, items, 0);
+    queue_.flush(renderer);
+
+    SDL_SetRenderTarget(renderer, previous);
+    ++redraws_;
+    return true;
+}
+
+void push_hud(RenderQueue& queue, const BitmapFont& font, const std::vector<HudDraw>& items,
+              int layer) {
+    for (const auto& item : items) {
+        switch (item.kind) {
+        case HudDraw::Kind::Fill:
+            queue.push_fill(layer, item.rect, item.color);
+            break;
+        case HudDraw::Kind::Outline:
+            queue.push_outline(layer, item.rect, item.color);
+            break;
+        case HudDraw::Kind::Text:
+            font.push(queue, layer, item.text, item.rect.x, item.rect.y, item.color);
+            break;
+        }
+    }
+}
+
+} // namespace raven
@@ -0,0 +1,72 @@
+#pragma once
+
+#include "rendering/bitmap_font.hpp"
+#include "rendering/render_queue.hpp"
+#include "rendering/render_snapshot.hpp"
+
+#include <SDL3/SDL.h>
+
+#include <cstdint>
+#include <vector>
+
+namespace raven {
+
+/// @brief Screen-space HUD kept in a render-target texture between changes.
+///
+/// The HUD is a few dozen fills and glyphs that change a few times a second
+/// (health, lives, score, decay). draw() renders the items into the texture
+/// only when their version differs from the one it holds, and otherwise
+/// composites the texture as a single quad. Without a renderer, or if the
+/// texture cannot be created, the items are pushed into the frame's queue
+/// every frame instead. Main thread only, like any texture work.
+class HudLayer {
+  public:
+    /// @brief Prepare a layer; the texture is created on first draw.
+    /// @param width Texture width (the virtual screen width).
+    /// @param height Texture height (the virtual screen height).
+    HudLayer(int width, int height);
+    ~HudLayer();
+
+    HudLayer(const HudLayer&) = delete;
+    HudLayer& operator=(const HudLayer&) = delete;
+
+    /// @brief Queue the HUD on RenderQueue::LAYER_HUD, redrawing the texture if stale.
+    /// @param renderer SDL renderer that owns the texture; null pushes the items directly.
+    /// @param queue Frame queue to push the composite (or the items) into.
+    /// @param font Bitmap font for HUD text.
+    /// @param items HUD primitives in screen pixels.
+    /// @param version Version of @p items (see RetainedHud).
+    void draw(SDL_Renderer* renderer, RenderQueue& queue, const BitmapFont& font,
+              const std::vector<HudDraw>& items, uint64_t version);
+
+    /// @brief Redraw on the next draw() (render targets were reset).
+    void invalidate() { valid_ = false; }
+
+    /// @brief Times the texture was redrawn.
+    [[nodiscard]] int redraws() const { return redraws_; }
+
+  private:
+    /// @brief Render @p items into texture_.
+    /// @return False if there is no texture to composite.
+    bool redraw(SDL_Renderer* renderer, const BitmapFont& font,
+                const std::vector<HudDraw>& items);
+
+    SDL_Texture* texture_ = nullptr;
+    int width_;
+    int height_;
+    uint64_t version_ = 0;  ///< Version drawn into texture_.
+    bool valid_ = false;    ///< texture_ holds version_.
+    bool disabled_ = false; ///< Texture creation failed; push items directly.
+    int redraws_ = 0;
+    RenderQueue queue_; ///< Batches a redraw.
+};
+
+/// @brief Push HUD primitives into @p queue on @p layer.
+/// @param queue Queue to push into.
+/// @param font Bitmap font for HUD text.
+/// @param items HUD primitives in screen pixels.
+/// @param layer Queue layer.
+void push_hud(RenderQueue& queue, const BitmapFont& font, const std::vector<HudDraw>& items,
+              int layer);
+
+} // namespace raven
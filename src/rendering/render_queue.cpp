@@ -0,0 +1,202 @@
+#include "rendering/render_queue.hpp"
+
+#include <algorithm>
+#include <utility>
+
+namespace raven {
+
+void RenderQueue::push(int layer, SDL_Texture* texture, const SDL_FRect& src, const SDL_FRect& dst,
+                       SDL_Color color, SDL_FlipMode flip) {
+    constexpr float INV_255 = 1.f / 255.f;
+    quads_.push_back({layer, texture, src, dst,
+                      SDL_FColor{static_cast<float>(color.r) * INV_255,
+                                 static_cast<float>(color.g) * INV_255,
+                                 static_cast<float>(color.b) * INV_255,
+                                 static_cast<float>(color.a) * INV_255},
+                      flip});
+}
+
+void RenderQueue::push_fill(int layer, const SDL_FRect& dst, SDL_Color color) {
+    push(layer, nullptr, {}, dst, color);
+}
+
+void RenderQueue::push_outline(int layer, const SDL_FRect& rect, SDL_Color color) {
+    if (rect.w <= 0.f || rect.h <= 0.f) {
+        return;
+    }
+    push_fill(layer, {rect.x, rect.y, rect.w, 1.f}, color);
+    if (rect.h > 1.f) {
+        push_fill(layer, {rect.x, rect.y + rect.h - 1.f, rect.w, 1.f}, color);
+    }
+    if (rect.h > 2.f) {
+        push_fill(layer, {rect.x, rect.y + 1.f, 1.f, rect.h - 2.f}, color);
+        if (rect.w > 1.f) {
+            push_fill(layer, {rect.x + rect.w - 1.f, rect.y + 1.f, 1.f, rect.h - 2.f}, color);
+        }
+    }
+}
+
+void RenderQueue::order_quads() {
+    // Stable insertion sort by layer; pushes are mostly in layer order already
+    for (size_t i = 1; i < quads_.size(); ++i) {
+        if (quads_[i].layer >= quads_[i - 1].layer) {
+            continue;
+        }
+        Quad quad = quads_[i];
+        size_t j = i;
+        for (; j > 0 && quad.layer < quads_[j - 1].layer; --j) {
+            quads_[j] = quads_[j - 1];
+        }
+        quads_[j] = quad;
+    }
+
+    for (size_t begin = 0; begin < quads_.size();) {
+        size_t end = begin + 1;
+        bool mixed = false;
+        while (end < quads_.size() && quads_[end].layer == quads_[begin].layer) {
+            mixed = mixed || quads_[end].texture != quads_[begin].texture;
+            ++end;
+        }
+        if (mixed) {
+            group_by_texture(begin, end);
+        }
+        begin = end;
+    }
+}
+
+namespace {
+
+bool overlaps(const SDL_FRect& a, const SDL_FRect& b) {
+    return a.x < b.x + b.w && b.x < a.x + a.w && a.y < b.y + b.h && b.y < a.y + a.h;
+}
+
+SDL_FRect merge(const SDL_FRect& a, const SDL_FRect& b) {
+    const float x0 = std::min(a.x, b.x);
+    const float y0 = std::min(a.y, b.y);
+    const float x1 = std::max(a.x + a.w, b.x + b.w);
+    const float y1 = std::max(a.y + a.h, b.y + b.h);
+    return {x0, y0, x1 - x0, y1 - y0};
+}
+
+} // namespace
+
+size_t RenderQueue::joinable_run(size_t begin, size_t index) const {
+    const Quad& quad = quads_[index];
+    int tests = 0;
+    for (size_t r = runs_.size(); r > 0 && runs_.size() - r < GROUP_LOOKBACK; --r) {
+        const Run& run = runs_[r - 1];
+        if (run.texture == quad.texture) {
+            return r - 1;
+        }
+        if (!overlaps(run.bounds, quad.dst)) {
+            continue;
+        }
+        // Moving back past an overlapping quad would change what ends up on top
+        for (size_t m = run.first;; m = links_[m]) {
+            if (++tests > GROUP_TESTS || overlaps(quads_[begin + m].dst, quad.dst)) {
+                return runs_.size();
+            }
+            if (m == run.last) {
+                break;
+            }
+        }
+    }
+    return runs_.size();
+}
+
+void RenderQueue::group_by_texture(size_t begin, size_t end) {
+    runs_.clear();
+    links_.assign(end - begin, 0);
+    for (size_t i = begin; i < end; ++i) {
+        const size_t member = i - begin;
+        const size_t r = joinable_run(begin, i);
+        if (r == runs_.size()) {
+            runs_.push_back({quads_[i].texture, quads_[i].dst, member, member});
+            continue;
+        }
+        Run& run = runs_[r];
+        links_[run.last] = member;
+        run.last = member;
+        run.bounds = merge(run.bounds, quads_[i].dst);
+    }
+    if (runs_.size() == end - begin) {
+        return; // Nothing could be merged
+    }
+
+    scratch_.clear();
+    for (const Run& run : runs_) {
+        for (size_t m = run.first;; m = links_[m]) {
+            scratch_.push_back(quads_[begin + m]);
+            if (m == run.last) {
+                break;
+            }
+        }
+    }
+    std::copy(scratch_.begin(), scratch_.end(),
+              quads_.begin() + static_cast<std::ptrdiff_t>(begin));
+}
+
+void RenderQueue::flush(SDL_Renderer* renderer) {
+    order_quads();
+
+    for (size_t begin = 0; begin < quads_.size();) {
+        size_t end = begin + 1;
+        while (end < quads_.size() && quads_[end].layer == quads_[begin].layer &&
+               quads_[end].texture == quads_[begin].texture) {
+            ++end;
+        }
+
+        SDL_Texture* texture = quads_[begin].texture;
+        ++stats_.draw_calls;
+        stats_.quads += static_cast<int>(end - begin);
+        if (!renderer) {
+            begin = end;
+            continue;
+        }
+
+        float inv_w = 0.f;
+        float inv_h = 0.f;
+        if (texture) {
+            float tex_w = 0.f;
+            float tex_h = 0.f;
+            SDL_GetTextureSize(texture, &tex_w, &tex_h);
+            inv_w = tex_w > 0.f ? 1.f / tex_w : 0.f;
+            inv_h = tex_h > 0.f ? 1.f / tex_h : 0.f;
+        }
+
+        vertices_.clear();
+        indices_.clear();
+        for (size_t i = begin; i < end; ++i) {
+            const Quad& q = quads_[i];
+            float u0 = q.src.x * inv_w;
+            float v0 = q.src.y * inv_h;
+            float u1 = (q.src.x + q.src.w) * inv_w;
+            float v1 = (q.src.y + q.src.h) * inv_h;
+            if (q.flip & SDL_FLIP_HORIZONTAL) {
+                std::swap(u0, u1);
+            }
+            if (q.flip & SDL_FLIP_VERTICAL) {
+                std::swap(v0, v1);
+            }
+
+            const int base = static_cast<int>(vertices_.size());
+            const float x1 = q.dst.x + q.dst.w;
+            const float y1 = q.dst.y + q.dst.h;
+            vertices_.push_back({{q.dst.x, q.dst.y}, q.color, {u0, v0}});
+            vertices_.push_back({{x1, q.dst.y}, q.color, {u1, v0}});
+            vertices_.push_back({{x1, y1}, q.color, {u1, v1}});
+            vertices_.push_back({{q.dst.x, y1}, q.color, {u0, v1}});
+            for (int k : {0, 1, 2, 0, 2, 3}) {
+                indices_.push_back(base + k);
+            }
+        }
+
+        SDL_RenderGeometry(renderer, texture, vertices_.data(), static_cast<int>(vertices_.size()),
+                           indices_.data(), static_cast<int>(indices_.size()));
+        begin = end;
+    }
+
+    quads_.clear();
+}
+
+} // namespace raven
@@ -0,0 +1,104 @@
+#pragma once
+
+#include <SDL3/SDL.h>
+
+#include <cstddef>
+#include <vector>
+
+namespace raven {
+
+/// @brief Draw submissions and quads of one frame (see Renderer::frame_stats()).
+struct RenderStats {
+    int draw_calls = 0; ///< SDL_RenderGeometry calls.
+    int quads = 0;      ///< Quads across all calls.
+};
+
+/// @brief Collects quads for a frame and submits them with few SDL_RenderGeometry calls.
+///
+/// Callers push textured quads (sprite frames, tiles, glyphs) and untextured
+/// fills instead of drawing directly. flush() orders them by layer, then
+/// within a layer moves a quad back into an earlier run of its texture when
+/// it overlaps nothing drawn in between, and issues one geometry call per
+/// run of equal (layer, texture). Overlapping quads therefore keep push
+/// order (painter's order); only disjoint ones are regrouped. Per-quad
+/// colour goes in the vertices, so tinting never touches shared texture
+/// state.
+///
+/// Frames push in nearly sorted order (tiles, sprites by layer, HUD), so
+/// the ordering is an insertion sort plus a per-layer grouping pass with a
+/// bounded lookback, both close to linear, rather than a comparison sort.
+class RenderQueue {
+  public:
+    static constexpr int LAYER_TILES = -1000; ///< Below every sprite layer.
+    static constexpr int LAYER_HUD = 1000;    ///< Above every sprite layer.
+    static constexpr size_t GROUP_LOOKBACK = 8; ///< Earlier runs a quad may move back across.
+    static constexpr int GROUP_TESTS = 32;      ///< Per-quad overlap tests before giving up.
+
+    /// @brief Queue a textured quad.
+    /// @param layer Draw order; higher layers draw on top.
+    /// @param texture Texture to sample; null queues an untextured fill.
+    /// @param src Source rect in texels (ignored for fills).
+    /// @param dst Destination rect in render-target pixels.
+    /// @param color Vertex colour multiplied with the texture.
+    /// @param flip Mirror the source horizontally and/or vertically.
+    void push(int layer, SDL_Texture* texture, const SDL_FRect& src, const SDL_FRect& dst,
+              SDL_Color color = {255, 255, 255, 255}, SDL_FlipMode flip = SDL_FLIP_NONE);
+
+    /// @brief Queue a solid rectangle.
+    void push_fill(int layer, const SDL_FRect& dst, SDL_Color color);
+
+    /// @brief Queue a one-pixel rectangle outline as four fills.
+    void push_outline(int layer, const SDL_FRect& rect, SDL_Color color);
+
+    /// @brief Submit everything queued, then empty the queue.
+    ///
+    /// Adds to stats(). With a null renderer the quads are sorted and
+    /// counted but not drawn (tests).
+    void flush(SDL_Renderer* renderer);
+
+    /// @brief Quads waiting for flush().
+    [[nodiscard]] size_t size() const { return quads_.size(); }
+
+    /// @brief Totals since the last reset_stats().
+    [[nodiscard]] const RenderStats& stats() const { return stats_; }
+
+    /// @brief Zero stats(); Renderer does this at the start of every frame.
+    void reset_stats() { stats_ = {}; }
+
+  private:
+    struct Quad {
+        int layer;
+        SDL_Texture* texture;
+        SDL_FRect src; ///< Texels; turned into UVs once per texture run.
+        SDL_FRect dst;
+        SDL_FColor color;
+        SDL_FlipMode flip;
+    };
+
+    /// @brief Put quads_ in (layer, texture group, push order) order.
+    void order_quads();
+
+    /// @brief Gather quads_[begin, end) into runs by texture without reordering overlaps.
+    void group_by_texture(size_t begin, size_t end);
+
+    /// @brief Run of one texture built by group_by_texture().
+    struct Run {
+        SDL_Texture* texture;
+        SDL_FRect bounds; ///< Union of the members' dst.
+        size_t first;     ///< First member, relative to the layer start.
+        size_t last;      ///< Last member; members are chained through links_.
+    };
+
+    /// @brief Earlier run quads_[index] can join, or runs_.size() if none.
+    [[nodiscard]] size_t joinable_run(size_t begin, size_t index) const;
+
+    std::vector<Quad> quads_;
+    std::vector<Quad> scratch_; ///< Scratch for group_by_texture().
+    std::vector<Run> runs_;     ///< Scratch for group_by_texture().
+    std::vector<size_t> links_; ///< Next member of the same run, per quad of the layer.
+    std::vector<SDL_Vertex> vertices_;   ///< Scratch for flush().
+    std::vector<int> indices_;           ///< Scratch for flush().
+    RenderStats stats_;
+};
+
+} // namespace raven
@@ -0,0 +1,53 @@
+#include "rendering/render_snapshot.hpp"
+
+#include "rendering/hud_layer.hpp"
+
+#include <cmath>
+
+namespace raven {
+
+void draw_render_snapshot(const RenderSnapshot& snapshot, SDL_Renderer* renderer,
+                          RenderQueue& queue, const BitmapFont& font, HudLayer& hud,
+                          float alpha) {
+    const float cam_x = std::round(snapshot.camera_prev.x +
+                                   (snapshot.camera.x - snapshot.camera_prev.x) * alpha);
+    const float cam_y = std::round(snapshot.camera_prev.y +
+                                   (snapshot.camera.y - snapshot.camera_prev.y) * alpha);
+
+    for (const auto& tile : snapshot.tiles) {
+        SDL_FRect dest{tile.dest.x - cam_x, tile.dest.y - cam_y, tile.dest.w, tile.dest.h};
+        queue.push(RenderQueue::LAYER_TILES, tile.texture, tile.src, dest, {255, 255, 255, 255},
+                   tile.flip);
+    }
+
+    for (const auto& s : snapshot.sprites) {
+        float x = s.prev_x + (s.x - s.prev_x) * alpha - cam_x;
+        float y = s.prev_y + (s.y - s.prev_y) * alpha - cam_y;
+
+        if (!s.sheet) {
+            // No sprite sheet loaded — draw a placeholder colored rect
+            SDL_FRect rect{x + s.offset_x - static_cast<float>(s.width) / 2.f,
+                           y + s.offset_y - static_cast<float>(s.height) / 2.f,
+                           static_cast<float>(s.width), static_cast<float>(s.height)};
+            queue.push_fill(s.layer, rect, s.placeholder);
+            continue;
+        }
+
+        // Snap to whole pixels like SpriteSheet::draw's int destination
+        SDL_FRect dst{static_cast<float>(
+                          static_cast<int>(x + s.offset_x - static_cast<float>(s.width) / 2.f)),
+                      static_cast<float>(
+                          static_cast<int>(y + s.offset_y - static_cast<float>(s.height) / 2.f)),
+                      static_cast<float>(s.width), static_cast<float>(s.height)};
+        s.sheet->push(queue, s.layer, s.frame_x, s.frame_y, dst, s.flip_x);
+    }
+
+    hud.draw(renderer, queue, font, snapshot.hud, snapshot.hud_version);
+
+    queue.flush(renderer);
+
+    // Debug shapes are untextured and go out in one call of their own
+    snapshot.debug.draw(renderer, cam_x, cam_y);
+}
+
+} // namespace raven
@@ -0,0 +1,102 @@
+#pragma once
+
+#include "rendering/bitmap_font.hpp"
+#include "rendering/debug_draw.hpp"
+#include "rendering/render_queue.hpp"
+#include "rendering/sprite_sheet.hpp"
+
+#include <SDL3/SDL.h>
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace raven {
+
+class HudLayer;
+
+/// @brief One sprite (or placeholder rect) with both interpolation endpoints.
+struct SpriteDraw {
+    const SpriteSheet* sheet = nullptr; ///< Sheet to draw from; null draws a placeholder.
+    float prev_x = 0.f;                 ///< Centre X at the previous tick.
+    float prev_y = 0.f;                 ///< Centre Y at the previous tick.
+    float x = 0.f;                      ///< Centre X at the snapshot tick.
+    float y = 0.f;                      ///< Centre Y at the snapshot tick.
+    float offset_x = 0.f;               ///< Draw offset from the centre.
+    float offset_y = 0.f;               ///< Draw offset from the centre.
+    int frame_x = 0;                    ///< Frame column in the sheet.
+    int frame_y = 0;                    ///< Frame row in the sheet.
+    int width = 0;                      ///< Frame width in pixels.
+    int height = 0;                     ///< Frame height in pixels.
+    int layer = 0;                      ///< Sprite::layer (snapshot is sorted by it).
+    bool flip_x = false;                ///< Mirror horizontally.
+    SDL_Color placeholder{};            ///< Fill colour when sheet is null.
+};
+
+/// @brief One tilemap tile (or a baked run of them), in world pixels.
+struct TileDraw {
+    SDL_Texture* texture = nullptr; ///< Tileset or room texture (owned by the Tilemap).
+    SDL_FRect src{};                ///< Source rect in the tileset.
+    SDL_FRect dest{};               ///< Destination rect in world pixels.
+    SDL_FlipMode flip = SDL_FLIP_NONE;
+};
+
+/// @brief One HUD primitive in screen pixels.
+struct HudDraw {
+    enum class Kind : uint8_t { Fill, Outline, Text };
+    Kind kind = Kind::Fill;
+    SDL_FRect rect{};  ///< Rect to fill/outline; for Text only x and y are used.
+    SDL_Color color{}; ///< Draw colour.
+    std::string text;  ///< Text for Kind::Text.
+};
+
+/// @brief Same kind, rect, colour and text.
+[[nodiscard]] inline bool operator==(const HudDraw& a, const HudDraw& b) {
+    return a.kind == b.kind && a.rect.x == b.rect.x && a.rect.y == b.rect.y &&
+           a.rect.w == b.rect.w && a.rect.h == b.rect.h && a.color.r == b.color.r &&
+           a.color.g == b.color.g && a.color.b == b.color.b && a.color.a == b.color.a &&
+           a.text == b.text;
+}
+
+/// @brief Everything GameScene draws for one simulation tick.
+///
+/// Built at the end of a tick by the simulation and handed to the main
+/// thread through a TripleBuffer, so rendering never reads the registry.
+/// Textures are borrowed: sprite sheets live as long as Game, and tiles are
+/// re-extracted whenever the owning Tilemap reloads (see tiles_revision).
+struct RenderSnapshot {
+    uint64_t tick = 0;               ///< SimTick the snapshot was taken after.
+    uint64_t tiles_revision = 0;     ///< Tilemap load the tiles were copied from (0 = none).
+    SDL_Rect tiles_chunks{};         ///< Tilemap chunk range the tiles were copied from.
+    SDL_FPoint camera_prev{};        ///< Camera top-left at the previous tick.
+    SDL_FPoint camera{};             ///< Camera top-left at the snapshot tick.
+    std::vector<TileDraw> tiles;     ///< Background tiles in draw order.
+    std::vector<SpriteDraw> sprites; ///< Placeholders first, then sprites by layer.
+    std::vector<HudDraw> hud;        ///< HUD primitives in draw order.
+    uint64_t hud_version = 0;        ///< RetainedHud::version the HUD was copied from.
+    DebugDraw debug;                 ///< Debug shapes in world pixels (see DebugDrawFlags).
+};
+
+/// @brief Draw a snapshot: tiles, then sprites at @p alpha between their
+/// endpoints, then the HUD.
+///
+/// Tiles and sprites are offset by the camera, interpolated the same way and
+/// rounded to whole pixels so the level scrolls without shimmering; the HUD
+/// stays in screen space and comes from @p hud, which redraws its texture
+/// only when snapshot.hud_version changes.
+///
+/// Everything goes through @p queue (tiles on RenderQueue::LAYER_TILES,
+/// sprites on their own layer, the HUD on RenderQueue::LAYER_HUD), which is
+/// flushed before returning so overlays can draw on top. Debug shapes, if
+/// any were recorded, follow in one extra geometry call over everything.
+/// @param snapshot The snapshot to draw.
+/// @param renderer The SDL_Renderer to draw with.
+/// @param queue Queue to batch the quads in.
+/// @param font Bitmap font for HUD text.
+/// @param hud Cached HUD texture.
+/// @param alpha Blend factor [0,1] from the previous tick to the snapshot tick.
+void draw_render_snapshot(const RenderSnapshot& snapshot, SDL_Renderer* renderer,
+                          RenderQueue& queue, const BitmapFont& font, HudLayer& hud,
+                          float alpha);
+
+} // namespace raven
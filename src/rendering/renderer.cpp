@@ -109,6 +109,7 @@ void Renderer::handle_event(const SDL_Event& event) {
     if (event.type == SDL_EVENT_RENDER_TARGETS_RESET ||
         event.type == SDL_EVENT_RENDER_DEVICE_RESET) {
         spdlog::warn("Render targets reset — recreating");
+        ++target_generation_;
         recreate_target();
     } else if (event.type == SDL_EVENT_WINDOW_PIXEL_SIZE_CHANGED) {
         recreate_target();
@@ -130,12 +131,14 @@ void Renderer::recreate_target() {
 }
 
 void Renderer::begin_frame() {
+    queue_.reset_stats();
     SDL_SetRenderTarget(renderer_, render_target_);
     SDL_SetRenderDrawColor(renderer_, 0, 0, 0, 255);
     SDL_RenderClear(renderer_);
 }
 
 void Renderer::end_frame() {
+    queue_.flush(renderer_);
     SDL_SetRenderTarget(renderer_, nullptr);
     SDL_SetRenderDrawColor(renderer_, 0, 0, 0, 255);
     SDL_RenderClear(renderer_);
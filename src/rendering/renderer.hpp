@@ -1,7 +1,10 @@
 #pragma once
 
+#include "rendering/render_queue.hpp"
+
 #include <SDL3/SDL.h>
 
+#include <cstdint>
 #include <memory>
 #include <string>
 
@@ -60,6 +63,8 @@ class Renderer {
     void begin_frame();
 
     /// @brief End the frame by scaling the virtual target to the window. Does not present.
+    ///
+    /// Flushes anything still in queue() first.
     void end_frame();
 
     /// @brief Present the rendered frame. Call after any overlays have drawn.
@@ -73,6 +78,24 @@ class Renderer {
     /// @return Pointer to the SDL_Renderer (never null after successful init).
     [[nodiscard]] SDL_Renderer* sdl_renderer() const { return renderer_; }
 
+    /// @brief Quad queue for batched drawing into the virtual target.
+    ///
+    /// Push during a scene's render() and flush() before drawing anything
+    /// directly on top (overlays do, e.g. the pause dimmer).
+    /// @return Mutable reference to the RenderQueue.
+    RenderQueue& queue() { return queue_; }
+
+    /// @brief Draw calls and quads submitted through queue() this frame.
+    /// @return Counts, reset by begin_frame(); complete once end_frame() ran.
+    [[nodiscard]] const RenderStats& frame_stats() const { return queue_.stats(); }
+
+    /// @brief Number of render target resets seen so far.
+    ///
+    /// Textures drawn into as render targets (e.g. Tilemap::room_texture())
+    /// may lose their contents on a reset; owners redraw them when this changes.
+    /// @return Reset counter, starting at 0.
+    [[nodiscard]] uint64_t target_generation() const { return target_generation_; }
+
     /// @brief Get the raw SDL_Window pointer.
     /// @return Pointer to the SDL_Window (never null after successful init).
     [[nodiscard]] SDL_Window* sdl_window() const { return window_; }
@@ -90,6 +113,8 @@ class Renderer {
     SDL_Renderer* renderer_ = nullptr;
     SDL_Texture* render_target_ = nullptr; ///< Virtual resolution render target.
     bool vsync_enabled_ = false;           ///< True if the driver accepted vsync.
+    uint64_t target_generation_ = 0;       ///< Bumped on every render target reset.
+    RenderQueue queue_;
 
     /// @brief Destroy and recreate the virtual resolution render target.
     void recreate_target();
@@ -1,46 +1,76 @@
 #include "rendering/sprite_sheet.hpp"
 
-#include <SDL3_image/SDL_image.h>
+#include "core/asset_pack.hpp"
+
 #include <spdlog/spdlog.h>
 
 namespace raven {
 
 SpriteSheet::~SpriteSheet() {
-    if (texture_) {
+    if (texture_ && owns_texture_) {
         SDL_DestroyTexture(texture_);
     }
 }
 
 bool SpriteSheet::load(SDL_Renderer* renderer, const std::string& path, int frame_width,
                        int frame_height) {
-    SDL_Surface* surface = IMG_Load(path.c_str());
+    SDL_Surface* surface = assets::load_surface(path);
     if (!surface) {
         spdlog::error("Failed to load sprite sheet '{}': {}", path, SDL_GetError());
         return false;
     }
 
-    texture_ = SDL_CreateTextureFromSurface(renderer, surface);
-    sheet_w_ = surface->w;
-    sheet_h_ = surface->h;
+    bool created = create(renderer, surface, frame_width, frame_height);
     SDL_DestroySurface(surface);
-
-    if (!texture_) {
+    if (!created) {
         spdlog::error("Failed to create texture from '{}': {}", path, SDL_GetError());
         return false;
     }
 
+    spdlog::debug("Loaded sprite sheet '{}': {}x{}, frames {}x{}", path, sheet_w_, sheet_h_,
+                  frame_w_, frame_h_);
+
+    return true;
+}
+
+bool SpriteSheet::create(SDL_Renderer* renderer, SDL_Surface* surface, int frame_width,
+                         int frame_height) {
+    SDL_Texture* texture = SDL_CreateTextureFromSurface(renderer, surface);
+    if (!texture) {
+        return false;
+    }
+    if (texture_ && owns_texture_) {
+        SDL_DestroyTexture(texture_);
+    }
+    texture_ = texture;
+    owns_texture_ = true;
+    origin_x_ = 0;
+    origin_y_ = 0;
+    sheet_w_ = surface->w;
+    sheet_h_ = surface->h;
+
     SDL_SetTextureBlendMode(texture_, SDL_BLENDMODE_BLEND);
     SDL_SetTextureScaleMode(texture_, SDL_SCALEMODE_PIXELART);
 
     frame_w_ = frame_width;
     frame_h_ = frame_height;
-
-    spdlog::debug("Loaded sprite sheet '{}': {}x{}, frames {}x{}", path, sheet_w_, sheet_h_,
-                  frame_w_, frame_h_);
-
     return true;
 }
 
+void SpriteSheet::attach(const AtlasRegion& region, int frame_width, int frame_height) {
+    if (texture_ && owns_texture_) {
+        SDL_DestroyTexture(texture_);
+    }
+    texture_ = region.texture;
+    owns_texture_ = false;
+    origin_x_ = region.rect.x;
+    origin_y_ = region.rect.y;
+    sheet_w_ = region.rect.w;
+    sheet_h_ = region.rect.h;
+    frame_w_ = frame_width;
+    frame_h_ = frame_height;
+}
+
 void SpriteSheet::draw(SDL_Renderer* renderer, int frame_x, int frame_y, int dest_x, int dest_y,
                        bool flip_x) const {
     draw(renderer, frame_x, frame_y, dest_x, dest_y, frame_w_, frame_h_, flip_x);
@@ -51,8 +81,7 @@ void SpriteSheet::draw(SDL_Renderer* renderer, int frame_x, int frame_y, int des
     if (!texture_)
         return;
 
-    SDL_FRect src{static_cast<float>(frame_x * frame_w_), static_cast<float>(frame_y * frame_h_),
-                  static_cast<float>(frame_w_), static_cast<float>(frame_h_)};
+    SDL_FRect src = frame_rect(frame_x, frame_y);
 
     SDL_FRect dst{static_cast<float>(dest_x), static_cast<float>(dest_y),
                   static_cast<float>(dest_w), static_cast<float>(dest_h)};
@@ -61,6 +90,15 @@ void SpriteSheet::draw(SDL_Renderer* renderer, int frame_x, int frame_y, int des
     SDL_RenderTextureRotated(renderer, texture_, &src, &dst, 0.0, nullptr, flip);
 }
 
+void SpriteSheet::push(RenderQueue& queue, int layer, int frame_x, int frame_y,
+                       const SDL_FRect& dst, bool flip_x) const {
+    if (!texture_) {
+        return;
+    }
+    queue.push(layer, texture_, frame_rect(frame_x, frame_y), dst, {255, 255, 255, 255},
+               flip_x ? SDL_FLIP_HORIZONTAL : SDL_FLIP_NONE);
+}
+
 // ── SpriteSheetManager ───────────────────────────────────────────
 
 bool SpriteSheetManager::load(SDL_Renderer* renderer, const std::string& id,
@@ -73,6 +111,23 @@ bool SpriteSheetManager::load(SDL_Renderer* renderer, const std::string& id,
     return true;
 }
 
+bool SpriteSheetManager::add(SDL_Renderer* renderer, const std::string& id, SDL_Surface* surface,
+                             int frame_w, int frame_h) {
+    auto sheet = std::make_unique<SpriteSheet>();
+    if (!sheet->create(renderer, surface, frame_w, frame_h)) {
+        return false;
+    }
+    sheets_[id] = std::move(sheet);
+    return true;
+}
+
+void SpriteSheetManager::add(const std::string& id, const AtlasRegion& region, int frame_w,
+                             int frame_h) {
+    auto sheet = std::make_unique<SpriteSheet>();
+    sheet->attach(region, frame_w, frame_h);
+    sheets_[id] = std::move(sheet);
+}
+
 const SpriteSheet* SpriteSheetManager::get(const std::string& id) const {
     auto it = sheets_.find(id);
     return it != sheets_.end() ? it->second.get() : nullptr;
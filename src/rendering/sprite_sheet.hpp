@@ -1,5 +1,8 @@
 #pragma once
 
+#include "rendering/render_queue.hpp"
+#include "rendering/texture_atlas.hpp"
+
 #include <SDL3/SDL.h>
 
 #include <memory>
@@ -25,6 +28,20 @@ class SpriteSheet {
     /// @return True on success, false if the image could not be loaded.
     bool load(SDL_Renderer* renderer, const std::string& path, int frame_width, int frame_height);
 
+    /// @brief Create the texture from an image decoded elsewhere (see Game::load_assets).
+    /// @param renderer SDL_Renderer used to create the texture.
+    /// @param surface Decoded image; the caller keeps ownership.
+    /// @param frame_width Width of a single frame in pixels.
+    /// @param frame_height Height of a single frame in pixels.
+    /// @return True on success, false if texture creation failed.
+    bool create(SDL_Renderer* renderer, SDL_Surface* surface, int frame_width, int frame_height);
+
+    /// @brief Draw from a region of a shared atlas page instead of an own texture.
+    /// @param region Where the sheet was packed (see TextureAtlas::add()).
+    /// @param frame_width Width of a single frame in pixels.
+    /// @param frame_height Height of a single frame in pixels.
+    void attach(const AtlasRegion& region, int frame_width, int frame_height);
+
     /// @brief Draw one frame from the sprite sheet at the given position.
     /// @param renderer SDL_Renderer to draw with.
     /// @param frame_x Frame column index (0-based).
@@ -47,6 +64,16 @@ class SpriteSheet {
     void draw(SDL_Renderer* renderer, int frame_x, int frame_y, int dest_x, int dest_y, int dest_w,
               int dest_h, bool flip_x = false) const;
 
+    /// @brief Queue one frame scaled to a destination rect (see RenderQueue).
+    /// @param queue Queue to push the quad into.
+    /// @param layer Draw order within the queue.
+    /// @param frame_x Frame column index (0-based).
+    /// @param frame_y Frame row index (0-based).
+    /// @param dst Destination rect in virtual pixels.
+    /// @param flip_x If true, flip the sprite horizontally.
+    void push(RenderQueue& queue, int layer, int frame_x, int frame_y, const SDL_FRect& dst,
+              bool flip_x = false) const;
+
     /// @brief Get the width of a single frame.
     /// @return Frame width in pixels.
     [[nodiscard]] int frame_width() const { return frame_w_; }
@@ -55,8 +82,21 @@ class SpriteSheet {
     /// @return Frame height in pixels.
     [[nodiscard]] int frame_height() const { return frame_h_; }
 
+    /// @brief Texture the frames are drawn from (an atlas page once attached).
+    [[nodiscard]] SDL_Texture* texture() const { return texture_; }
+
+    /// @brief Source rect of a frame in texture(), atlas offset included.
+    [[nodiscard]] SDL_FRect frame_rect(int frame_x, int frame_y) const {
+        return {static_cast<float>(origin_x_ + frame_x * frame_w_),
+                static_cast<float>(origin_y_ + frame_y * frame_h_), static_cast<float>(frame_w_),
+                static_cast<float>(frame_h_)};
+    }
+
   private:
     SDL_Texture* texture_ = nullptr;
+    bool owns_texture_ = true; ///< False when texture_ is a borrowed atlas page.
+    int origin_x_ = 0;         ///< Sheet's top-left in texture_.
+    int origin_y_ = 0;
     int frame_w_ = 0;
     int frame_h_ = 0;
     int sheet_w_ = 0;
@@ -76,6 +116,23 @@ class SpriteSheetManager {
     bool load(SDL_Renderer* renderer, const std::string& id, const std::string& path, int frame_w,
               int frame_h);
 
+    /// @brief Register a sprite sheet created from an already decoded image.
+    /// @param renderer SDL_Renderer used to create the texture.
+    /// @param id Unique identifier for later retrieval.
+    /// @param surface Decoded image; the caller keeps ownership.
+    /// @param frame_w Width of a single frame in pixels.
+    /// @param frame_h Height of a single frame in pixels.
+    /// @return True on success, false if texture creation failed.
+    bool add(SDL_Renderer* renderer, const std::string& id, SDL_Surface* surface, int frame_w,
+             int frame_h);
+
+    /// @brief Register a sprite sheet that draws from an atlas region.
+    /// @param id Unique identifier for later retrieval.
+    /// @param region Where the sheet's image was packed.
+    /// @param frame_w Width of a single frame in pixels.
+    /// @param frame_h Height of a single frame in pixels.
+    void add(const std::string& id, const AtlasRegion& region, int frame_w, int frame_h);
+
     /// @brief Retrieve a loaded sprite sheet by ID.
     /// @param id The identifier used when the sheet was loaded.
     /// @return Pointer to the SpriteSheet, or nullptr if not found.
@@ -0,0 +1,180 @@
+#include "rendering/texture_atlas.hpp"
+
+#include <spdlog/spdlog.h>
+
+#include <algorithm>
+#include <climits>
+
+namespace raven {
+
+// ── SkylinePacker ─────────────────────────────────────────────────
+
+SkylinePacker::SkylinePacker(int width, int height) : width_(width), height_(height) {
+    skyline_.push_back({0, 0, width});
+}
+
+int SkylinePacker::fit(size_t i, int w, int h) const {
+    if (skyline_[i].x + w > width_) {
+        return -1;
+    }
+    int y = 0;
+    int remaining = w;
+    for (size_t j = i; remaining > 0; ++j) {
+        y = std::max(y, skyline_[j].y);
+        if (y + h > height_) {
+            return -1;
+        }
+        remaining -= skyline_[j].w;
+    }
+    return y;
+}
+
+std::optional<SDL_Rect> SkylinePacker::insert(int w, int h) {
+    if (w <= 0 || h <= 0) {
+        return std::nullopt;
+    }
+
+    size_t best = skyline_.size();
+    int best_top = INT_MAX;
+    int best_width = INT_MAX;
+    int best_y = 0;
+    for (size_t i = 0; i < skyline_.size(); ++i) {
+        int y = fit(i, w, h);
+        if (y < 0) {
+            continue;
+        }
+        if (y + h < best_top || (y + h == best_top && skyline_[i].w < best_width)) {
+            best = i;
+            best_top = y + h;
+            best_width = skyline_[i].w;
+            best_y = y;
+        }
+    }
+    if (best == skyline_.size()) {
+        return std::nullopt;
+    }
+
+    SDL_Rect placed{skyline_[best].x, best_y, w, h};
+    skyline_.insert(skyline_.begin() + static_cast<std::ptrdiff_t>(best), {placed.x, best_top, w});
+
+    // Trim the segments the new one now covers
+    for (size_t i = best + 1; i < skyline_.size();) {
+        const auto& prev = skyline_[i - 1];
+        int overlap = prev.x + prev.w - skyline_[i].x;
+        if (overlap <= 0) {
+            break;
+        }
+        skyline_[i].x += overlap;
+        skyline_[i].w -= overlap;
+        if (skyline_[i].w > 0) {
+            break;
+        }
+        skyline_.erase(skyline_.begin() + static_cast<std::ptrdiff_t>(i));
+    }
+
+    // Merge neighbours left at the same height
+    for (size_t i = 0; i + 1 < skyline_.size();) {
+        if (skyline_[i].y == skyline_[i + 1].y) {
+            skyline_[i].w += skyline_[i + 1].w;
+            skyline_.erase(skyline_.begin() + static_cast<std::ptrdiff_t>(i + 1));
+        } else {
+            ++i;
+        }
+    }
+    return placed;
+}
+
+// ── TextureAtlas ──────────────────────────────────────────────────
+
+TextureAtlas::~TextureAtlas() {
+    clear();
+}
+
+void TextureAtlas::clear() {
+    for (auto& page : pages_) {
+        SDL_DestroyTexture(page.texture);
+    }
+    pages_.clear();
+    regions_.clear();
+}
+
+TextureAtlas::Page* TextureAtlas::new_page(SDL_Renderer* renderer, int min_w, int min_h) {
+    auto max_size = static_cast<int>(
+        SDL_GetNumberProperty(SDL_GetRendererProperties(renderer),
+                              SDL_PROP_RENDERER_MAX_TEXTURE_SIZE_NUMBER, PAGE_SIZE));
+    int w = std::max(std::min(PAGE_SIZE, max_size), min_w);
+    int h = std::max(std::min(PAGE_SIZE, max_size), min_h);
+    if (w > max_size || h > max_size) {
+        SDL_SetError("Image of %dx%d exceeds the renderer's %d px texture limit", min_w, min_h,
+                     max_size);
+        return nullptr;
+    }
+
+    SDL_Texture* texture =
+        SDL_CreateTexture(renderer, SDL_PIXELFORMAT_RGBA32, SDL_TEXTUREACCESS_STATIC, w, h);
+    if (!texture) {
+        return nullptr;
+    }
+    SDL_SetTextureBlendMode(texture, SDL_BLENDMODE_BLEND);
+    SDL_SetTextureScaleMode(texture, SDL_SCALEMODE_PIXELART);
+
+    pages_.push_back({texture, SkylinePacker{w, h}});
+    spdlog::debug("Created atlas page {} ({}x{})", pages_.size() - 1, w, h);
+    return &pages_.back();
+}
+
+AtlasRegion TextureAtlas::add(SDL_Renderer* renderer, const std::string& key,
+                              SDL_Surface* surface) {
+    if (auto it = regions_.find(key); it != regions_.end()) {
+        return it->second;
+    }
+
+    const int padded_w = surface->w + 2 * PADDING;
+    const int padded_h = surface->h + 2 * PADDING;
+
+    Page* page = nullptr;
+    std::optional<SDL_Rect> slot;
+    for (auto& p : pages_) {
+        if ((slot = p.packer.insert(padded_w, padded_h))) {
+            page = &p;
+            break;
+        }
+    }
+    if (!page) {
+        page = new_page(renderer, padded_w, padded_h);
+        if (!page) {
+            spdlog::error("Failed to create atlas page for '{}': {}", key, SDL_GetError());
+            return {};
+        }
+        slot = page->packer.insert(padded_w, padded_h);
+    }
+
+    // Upload the image inside a cleared gutter so neighbours never bleed in
+    SDL_Surface* padded = SDL_CreateSurface(padded_w, padded_h, SDL_PIXELFORMAT_RGBA32);
+    if (!padded) {
+        spdlog::error("Failed to stage '{}' for the atlas: {}", key, SDL_GetError());
+        return {};
+    }
+    SDL_ClearSurface(padded, 0.f, 0.f, 0.f, 0.f);
+    SDL_BlendMode blend = SDL_BLENDMODE_NONE;
+    SDL_GetSurfaceBlendMode(surface, &blend);
+    SDL_SetSurfaceBlendMode(surface, SDL_BLENDMODE_NONE);
+    SDL_Rect inner{PADDING, PADDING, surface->w, surface->h};
+    bool blitted = SDL_BlitSurface(surface, nullptr, padded, &inner);
+    SDL_SetSurfaceBlendMode(surface, blend);
+    if (!blitted || !SDL_UpdateTexture(page->texture, &*slot, padded->pixels, padded->pitch)) {
+        spdlog::error("Failed to copy '{}' into the atlas: {}", key, SDL_GetError());
+        SDL_DestroySurface(padded);
+        return {};
+    }
+    SDL_DestroySurface(padded);
+
+    AtlasRegion region{page->texture,
+                       {slot->x + PADDING, slot->y + PADDING, surface->w, surface->h}};
+    regions_.emplace(key, region);
+    spdlog::debug("Packed '{}' ({}x{}) at {},{} on atlas page {}", key, surface->w, surface->h,
+                  region.rect.x, region.rect.y, page - pages_.data());
+    return region;
+}
+
+} // namespace raven
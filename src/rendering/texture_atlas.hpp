@@ -0,0 +1,99 @@
+#pragma once
+
+#include <SDL3/SDL.h>
+
+#include <optional>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace raven {
+
+/// @brief Skyline bottom-left rectangle packer for one atlas page.
+///
+/// Tracks the top edge of everything placed so far as a list of horizontal
+/// segments and puts each new rect where its top ends up lowest (ties go to
+/// the narrower fit). Good enough for a handful of sprite sheets per page and
+/// cheap enough to run again when a tileset arrives with a new room.
+class SkylinePacker {
+  public:
+    /// @brief Start with an empty page.
+    /// @param width Page width in pixels.
+    /// @param height Page height in pixels.
+    SkylinePacker(int width, int height);
+
+    /// @brief Reserve a @p w x @p h rect.
+    /// @return Its position on the page, or nullopt if it does not fit.
+    [[nodiscard]] std::optional<SDL_Rect> insert(int w, int h);
+
+    /// @brief Page width in pixels.
+    [[nodiscard]] int width() const { return width_; }
+
+    /// @brief Page height in pixels.
+    [[nodiscard]] int height() const { return height_; }
+
+  private:
+    struct Segment {
+        int x;
+        int y; ///< Top of the used area below this segment.
+        int w;
+    };
+
+    /// @brief Lowest y at which a @p w wide rect can sit starting at segment @p i, or -1.
+    [[nodiscard]] int fit(size_t i, int w, int h) const;
+
+    int width_;
+    int height_;
+    std::vector<Segment> skyline_;
+};
+
+/// @brief Where an image ended up: a page texture and its rect on that page.
+struct AtlasRegion {
+    SDL_Texture* texture = nullptr; ///< Page texture (owned by the atlas); null if packing failed.
+    SDL_Rect rect{};                ///< Position and size on the page.
+};
+
+/// @brief Shared textures that sprite sheets, the font and tilesets are packed into.
+///
+/// Every texture switch between draws breaks SDL's batching, so images go
+/// onto as few large RGBA32 pages as fit. Pages are created on demand at
+/// PAGE_SIZE (clamped to the renderer's limit); an image bigger than that
+/// gets a page of its own. Images are keyed by path, so a tileset shared by
+/// several rooms is packed once. Main thread only, like any texture work.
+class TextureAtlas {
+  public:
+    static constexpr int PAGE_SIZE = 2048;
+    static constexpr int PADDING = 1; ///< Transparent gutter around each image.
+
+    TextureAtlas() = default;
+    ~TextureAtlas();
+
+    TextureAtlas(const TextureAtlas&) = delete;
+    TextureAtlas& operator=(const TextureAtlas&) = delete;
+
+    /// @brief Copy @p surface onto a page, or return where @p key already went.
+    /// @param renderer SDL renderer that owns the pages.
+    /// @param key Identity of the image, usually its path.
+    /// @param surface Decoded image; the caller keeps ownership.
+    /// @return The region; texture is null if a page could not be created.
+    AtlasRegion add(SDL_Renderer* renderer, const std::string& key, SDL_Surface* surface);
+
+    /// @brief Destroy every page. Regions handed out earlier become dangling.
+    void clear();
+
+    /// @brief Number of page textures.
+    [[nodiscard]] size_t page_count() const { return pages_.size(); }
+
+  private:
+    struct Page {
+        SDL_Texture* texture;
+        SkylinePacker packer;
+    };
+
+    Page* new_page(SDL_Renderer* renderer, int min_w, int min_h);
+
+    std::vector<Page> pages_;
+    std::unordered_map<std::string, AtlasRegion> regions_;
+};
+
+} // namespace raven
@@ -1,19 +1,39 @@
 #include "rendering/tilemap.hpp"
 
+#include "rendering/render_queue.hpp"
+
+#include <spdlog/spdlog.h>
+
 #include <algorithm>
+#include <cmath>
 #include <utility>
 
 namespace raven {
 
 Tilemap::~Tilemap() {
-    if (texture_) {
+    if (texture_ && owns_texture_) {
         SDL_DestroyTexture(texture_);
         texture_ = nullptr;
     }
+    if (room_texture_) {
+        SDL_DestroyTexture(room_texture_);
+        room_texture_ = nullptr;
+    }
+    if (pixels_) {
+        SDL_DestroySurface(pixels_);
+        pixels_ = nullptr;
+    }
 }
 
 Tilemap::Tilemap(Tilemap&& other) noexcept
-    : texture_(std::exchange(other.texture_, nullptr)), tiles_(std::move(other.tiles_)),
+    : texture_(std::exchange(other.texture_, nullptr)),
+      owns_texture_(std::exchange(other.owns_texture_, true)),
+      texture_origin_(std::exchange(other.texture_origin_, {})),
+      room_texture_(std::exchange(other.room_texture_, nullptr)),
+      pixels_(std::exchange(other.pixels_, nullptr)),
+      tileset_path_(std::move(other.tileset_path_)), tiles_(std::move(other.tiles_)),
+      chunk_offsets_(std::move(other.chunk_offsets_)), chunks_w_(other.chunks_w_),
+      chunks_h_(other.chunks_h_),
       collision_grid_(std::move(other.collision_grid_)), spawns_(std::move(other.spawns_)),
       width_px_(other.width_px_), height_px_(other.height_px_), cell_size_(other.cell_size_),
       grid_w_(other.grid_w_), grid_h_(other.grid_h_), loaded_(other.loaded_) {
@@ -22,11 +42,25 @@ Tilemap::Tilemap(Tilemap&& other) noexcept
 
 Tilemap& Tilemap::operator=(Tilemap&& other) noexcept {
     if (this != &other) {
-        if (texture_) {
+        if (texture_ && owns_texture_) {
             SDL_DestroyTexture(texture_);
         }
+        if (room_texture_) {
+            SDL_DestroyTexture(room_texture_);
+        }
+        if (pixels_) {
+            SDL_DestroySurface(pixels_);
+        }
         texture_ = std::exchange(other.texture_, nullptr);
+        owns_texture_ = std::exchange(other.owns_texture_, true);
+        texture_origin_ = std::exchange(other.texture_origin_, {});
+        room_texture_ = std::exchange(other.room_texture_, nullptr);
+        pixels_ = std::exchange(other.pixels_, nullptr);
+        tileset_path_ = std::move(other.tileset_path_);
         tiles_ = std::move(other.tiles_);
+        chunk_offsets_ = std::move(other.chunk_offsets_);
+        chunks_w_ = other.chunks_w_;
+        chunks_h_ = other.chunks_h_;
         collision_grid_ = std::move(other.collision_grid_);
         spawns_ = std::move(other.spawns_);
         width_px_ = other.width_px_;
@@ -40,6 +74,103 @@ Tilemap& Tilemap::operator=(Tilemap&& other) noexcept {
     return *this;
 }
 
+bool Tilemap::upload(SDL_Renderer* renderer, TextureAtlas* atlas) {
+    if (!pixels_) {
+        return true;
+    }
+    if (!upload_tileset(renderer, atlas)) {
+        return false;
+    }
+    // Not fatal: without a room texture the tiles are drawn one by one
+    bake(renderer);
+    return true;
+}
+
+bool Tilemap::upload_tileset(SDL_Renderer* renderer, TextureAtlas* atlas) {
+    if (atlas) {
+        AtlasRegion region = atlas->add(renderer, tileset_path_, pixels_);
+        if (region.texture) {
+            SDL_DestroySurface(pixels_);
+            pixels_ = nullptr;
+            texture_ = region.texture;
+            owns_texture_ = false;
+            texture_origin_ = {region.rect.x, region.rect.y};
+            return true;
+        }
+        // Fall through to an own texture
+    }
+
+    texture_ = SDL_CreateTextureFromSurface(renderer, pixels_);
+    SDL_DestroySurface(pixels_);
+    pixels_ = nullptr;
+    if (!texture_) {
+        spdlog::error("Failed to create tileset texture: {}", SDL_GetError());
+        return false;
+    }
+    SDL_SetTextureScaleMode(texture_, SDL_SCALEMODE_PIXELART);
+    return true;
+}
+
+bool Tilemap::bake(SDL_Renderer* renderer) {
+    if (!texture_ || tiles_.empty() || width_px_ <= 0 || height_px_ <= 0) {
+        return false;
+    }
+
+    if (!room_texture_) {
+        auto max_size = SDL_GetNumberProperty(SDL_GetRendererProperties(renderer),
+                                              SDL_PROP_RENDERER_MAX_TEXTURE_SIZE_NUMBER, 0);
+        if (max_size > 0 && (width_px_ > max_size || height_px_ > max_size)) {
+            spdlog::debug("Room {}x{} exceeds the {} px texture limit; drawing tiles directly",
+                          width_px_, height_px_, max_size);
+            return false;
+        }
+        room_texture_ = SDL_CreateTexture(renderer, SDL_PIXELFORMAT_RGBA32,
+                                          SDL_TEXTUREACCESS_TARGET, width_px_, height_px_);
+        if (!room_texture_) {
+            spdlog::warn("Failed to create room texture: {}", SDL_GetError());
+            return false;
+        }
+        // Blending straight-alpha tiles onto transparent black leaves
+        // premultiplied colour, so the room must be composited as such
+        SDL_SetTextureBlendMode(room_texture_, SDL_BLENDMODE_BLEND_PREMULTIPLIED);
+        SDL_SetTextureScaleMode(room_texture_, SDL_SCALEMODE_PIXELART);
+    }
+
+    SDL_Texture* previous = SDL_GetRenderTarget(renderer);
+    if (!SDL_SetRenderTarget(renderer, room_texture_)) {
+        spdlog::warn("Failed to draw into room texture: {}", SDL_GetError());
+        SDL_DestroyTexture(room_texture_);
+        room_texture_ = nullptr;
+        return false;
+    }
+    SDL_SetRenderDrawColor(renderer, 0, 0, 0, 0);
+    SDL_RenderClear(renderer);
+
+    RenderQueue queue;
+    for (const auto& tile : tiles_) {
+        int flip = SDL_FLIP_NONE;
+        if (tile.flip_x) {
+            flip |= SDL_FLIP_HORIZONTAL;
+        }
+        if (tile.flip_y) {
+            flip |= SDL_FLIP_VERTICAL;
+        }
+        queue.push(0, texture_,
+                   {static_cast<float>(texture_origin_.x + tile.src.x),
+                    static_cast<float>(texture_origin_.y + tile.src.y),
+                    static_cast<float>(tile.src.w), static_cast<float>(tile.src.h)},
+                   {static_cast<float>(tile.dest_x), static_cast<float>(tile.dest_y),
+                    static_cast<float>(tile.src.w), static_cast<float>(tile.src.h)},
+                   {255, 255, 255, 255}, static_cast<SDL_FlipMode>(flip));
+    }
+    queue.flush(renderer);
+
+    SDL_SetRenderTarget(renderer, previous);
+    spdlog::debug("Baked {} tiles into a {}x{} room texture", tiles_.size(), width_px_,
+                  height_px_);
+    return true;
+}
+
 void Tilemap::init_collision(int w, int h, int cell, std::vector<bool> grid) {
     grid_w_ = w;
     grid_h_ = h;
@@ -50,6 +181,68 @@ void Tilemap::init_collision(int w, int h, int cell, std::vector<bool> grid) {
     loaded_ = true;
 }
 
+void Tilemap::init_tiles(std::vector<TileData> tiles) {
+    tiles_ = std::move(tiles);
+    build_chunks();
+}
+
+void Tilemap::build_chunks() {
+    chunk_offsets_.clear();
+    chunks_w_ = 0;
+    chunks_h_ = 0;
+    const int size = chunk_size_px();
+    if (size <= 0 || width_px_ <= 0 || height_px_ <= 0) {
+        return;
+    }
+    chunks_w_ = (width_px_ + size - 1) / size;
+    chunks_h_ = (height_px_ + size - 1) / size;
+
+    auto chunk_of = [&](const TileData& tile) {
+        int cx = std::clamp(tile.dest_x / size, 0, chunks_w_ - 1);
+        int cy = std::clamp(tile.dest_y / size, 0, chunks_h_ - 1);
+        return static_cast<size_t>(cy * chunks_w_ + cx);
+    };
+
+    // Stable, so stacked layers on the same cell keep their back-to-front order
+    std::stable_sort(tiles_.begin(), tiles_.end(), [&](const TileData& a, const TileData& b) {
+        return chunk_of(a) < chunk_of(b);
+    });
+
+    chunk_offsets_.assign(static_cast<size_t>(chunks_w_ * chunks_h_) + 1, 0);
+    for (const auto& tile : tiles_) {
+        ++chunk_offsets_[chunk_of(tile) + 1];
+    }
+    for (size_t i = 1; i < chunk_offsets_.size(); ++i) {
+        chunk_offsets_[i] += chunk_offsets_[i - 1];
+    }
+}
+
+SDL_Rect Tilemap::chunks_in(const SDL_FRect& area, int margin) const {
+    if (chunks_w_ <= 0 || chunks_h_ <= 0) {
+        return {};
+    }
+    const auto size = static_cast<float>(chunk_size_px());
+    int x0 = std::max(static_cast<int>(std::floor(area.x / size)) - margin, 0);
+    int y0 = std::max(static_cast<int>(std::floor(area.y / size)) - margin, 0);
+    int x1 = std::min(static_cast<int>(std::floor((area.x + area.w) / size)) + margin,
+                      chunks_w_ - 1);
+    int y1 = std::min(static_cast<int>(std::floor((area.y + area.h) / size)) + margin,
+                      chunks_h_ - 1);
+    if (x1 < x0 || y1 < y0) {
+        return {};
+    }
+    return {x0, y0, x1 - x0 + 1, y1 - y0 + 1};
+}
+
+std::span<const TileData> Tilemap::chunk_tiles(int cx, int cy) const {
+    if (cx < 0 || cy < 0 || cx >= chunks_w_ || cy >= chunks_h_) {
+        return {};
+    }
+    auto i = static_cast<size_t>(cy * chunks_w_ + cx);
+    return std::span<const TileData>(tiles_).subspan(chunk_offsets_[i],
+                                                     chunk_offsets_[i + 1] - chunk_offsets_[i]);
+}
+
 bool Tilemap::is_solid(float x, float y, float w, float h) const {
     if (cell_size_ <= 0 || grid_w_ <= 0 || grid_h_ <= 0) {
         return false;
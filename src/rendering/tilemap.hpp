@@ -1,9 +1,15 @@
 #pragma once
 
+#include "rendering/texture_atlas.hpp"
+
 #include <SDL3/SDL.h>
 
+#include <cstdint>
+#include <span>
 #include <string>
 #include <unordered_map>
+#include <utility>
+#include <variant>
 #include <vector>
 
 namespace raven {
@@ -17,18 +23,35 @@ struct TileData {
     bool flip_y;  ///< Flip tile vertically.
 };
 
+/// @brief Value of a custom LDtk entity field, typed as in the LDtk project.
+///
+/// Point fields hold the world-pixel centre of the grid cell they name.
+using SpawnField = std::variant<std::string, int, float, bool, SDL_FPoint>;
+
 /// @brief Named spawn point extracted from an LDtk entity layer.
 struct SpawnPoint {
     std::string name; ///< Entity identifier (e.g. "PlayerStart", "EnemySpawn").
     float x;          ///< World X position in pixels.
     float y;          ///< World Y position in pixels.
-    std::unordered_map<std::string, std::string> fields; ///< Custom LDtk entity fields.
+    std::unordered_map<std::string, SpawnField> fields; ///< Custom LDtk entity fields.
+
+    /// @brief Look up a field of type @p T.
+    /// @return The value, or nullptr if the field is absent or has another type.
+    template <typename T> [[nodiscard]] const T* field(const std::string& key) const {
+        auto it = fields.find(key);
+        return it != fields.end() ? std::get_if<T>(&it->second) : nullptr;
+    }
 };
 
 /// @brief Tilemap loaded from an LDtk project. Holds pre-baked render data,
 /// a collision grid, and spawn points. Owned by GameScene, not an ECS entity.
+///
+/// Tiles are grouped into square chunks of CHUNK_TILES cells so that a level
+/// larger than the screen only draws the chunks near the camera.
 class Tilemap {
   public:
+    static constexpr int CHUNK_TILES = 16; ///< Chunk edge in grid cells.
+
     Tilemap() = default;
     ~Tilemap();
 
@@ -37,12 +60,74 @@ class Tilemap {
     Tilemap(Tilemap&& other) noexcept;
     Tilemap& operator=(Tilemap&& other) noexcept;
 
-    /// @brief Load a level from an LDtk project file.
+    /// @brief Load a level from an LDtk project file: parse() then upload().
     /// @param renderer SDL renderer for texture creation.
     /// @param ldtk_path Path to the .ldtk project file.
     /// @param level_name Name of the level to load.
+    /// @param atlas Atlas to pack the tileset into, or null for an own texture.
+    /// @return True on success.
+    bool load(SDL_Renderer* renderer, const std::string& ldtk_path, const std::string& level_name,
+              TextureAtlas* atlas = nullptr);
+
+    /// @brief Parse a level and decode its tileset without touching the renderer.
+    ///
+    /// Reads the level's baked blob when it is current (see load_baked()) and
+    /// falls back to parse_ldtk(). Safe to call off the main thread (see
+    /// GameScene's room prefetch). The decoded tileset waits in memory until
+    /// upload() turns it into a texture.
+    /// @param ldtk_path Path to the .ldtk project file.
+    /// @param level_name Name of the level to load.
+    /// @return True on success.
+    bool parse(const std::string& ldtk_path, const std::string& level_name);
+
+    /// @brief Parse a level straight from the LDtk project, ignoring baked blobs.
+    /// @param ldtk_path Path to the .ldtk project file.
+    /// @param level_name Name of the level to load.
+    /// @return True on success.
+    bool parse_ldtk(const std::string& ldtk_path, const std::string& level_name);
+
+    /// @brief Load a level baked by raven_bake_levels, if it is still current.
+    ///
+    /// The blob records the size, modification time and FNV-1a hash of the
+    /// .ldtk it was baked from. Size and time are checked first; if either
+    /// changed, the source is hashed, so a touched but identical project still
+    /// hits. When the source file is missing (e.g. a build that ships only
+    /// baked levels), the blob is trusted. On failure the tilemap is untouched.
+    /// @param rlvl_path Path to the baked level (see baked_level_path()).
+    /// @param ldtk_path Path to the .ldtk project the level was baked from.
+    /// @return False if the blob is missing, stale, or from another version.
+    bool load_baked(const std::string& rlvl_path, const std::string& ldtk_path);
+
+    /// @brief Write this tilemap as a baked level stamped with @p ldtk_path.
+    /// @param rlvl_path Output path; its directory must exist.
+    /// @param ldtk_path Path to the .ldtk project the level was parsed from.
     /// @return True on success.
-    bool load(SDL_Renderer* renderer, const std::string& ldtk_path, const std::string& level_name);
+    bool save_baked(const std::string& rlvl_path, const std::string& ldtk_path) const;
+
+    /// @brief Create the tileset texture from the pixels decoded by parse().
+    ///
+    /// Main thread only. Does nothing if there is nothing left to upload.
+    /// With an atlas the tileset is packed once per path and shared by every
+    /// room that uses it; the atlas must outlive the tilemap. Also bakes the
+    /// room texture (see bake()).
+    /// @param renderer SDL renderer for texture creation.
+    /// @param atlas Atlas to pack the tileset into, or null for an own texture.
+    /// @return False if texture creation failed.
+    bool upload(SDL_Renderer* renderer, TextureAtlas* atlas = nullptr);
+
+    /// @brief Draw every tile once into room_texture(), creating it if needed.
+    ///
+    /// Room geometry never changes after loading, so the frame draws one
+    /// room-sized quad instead of every tile. Call again after the renderer
+    /// reports a target reset (Renderer::target_generation()): the texture
+    /// survives but its contents may not. Main thread only, and not while
+    /// a tick may read room_texture(); owners caching that pointer must
+    /// treat a rebake like a reload. Leaves
+    /// room_texture() null when the room exceeds the renderer's texture
+    /// limit, in which case tiles() are drawn one by one.
+    /// @param renderer SDL renderer; its current render target is restored.
+    /// @return True if room_texture() holds the tiles.
+    bool bake(SDL_Renderer* renderer);
 
     /// @brief Initialise the collision grid directly (for tests and procedural gen).
     /// @param w Grid width in cells.
@@ -51,6 +136,33 @@ class Tilemap {
     /// @param grid Row-major solid flags (true = solid).
     void init_collision(int w, int h, int cell, std::vector<bool> grid);
 
+    /// @brief Set the tiles directly (for tests and procedural gen).
+    ///
+    /// Call after init_collision(), which sets the level and cell size the
+    /// tiles are chunked by.
+    /// @param tiles Tiles in draw order.
+    void init_tiles(std::vector<TileData> tiles);
+
+    /// @brief Set the spawn points directly (for tests and procedural gen).
+    /// @param spawns Spawn points in level order.
+    void init_spawns(std::vector<SpawnPoint> spawns) { spawns_ = std::move(spawns); }
+
+    /// @brief Chunks overlapping a world-space area.
+    /// @param area Area in world pixels, usually the camera view.
+    /// @param margin Extra chunks to include on every side.
+    /// @return Column/row range of chunks (x, y, w, h), clipped to the level;
+    ///         w and h are 0 when nothing overlaps.
+    [[nodiscard]] SDL_Rect chunks_in(const SDL_FRect& area, int margin = 0) const;
+
+    /// @brief Tiles whose top-left corner lies in a chunk, in draw order.
+    /// @param cx Chunk column.
+    /// @param cy Chunk row.
+    /// @return The chunk's tiles; empty if out of range.
+    [[nodiscard]] std::span<const TileData> chunk_tiles(int cx, int cy) const;
+
+    /// @brief Chunk edge in world pixels (0 before a level is loaded).
+    [[nodiscard]] int chunk_size_px() const { return CHUNK_TILES * cell_size_; }
+
     /// @brief Test if an AABB overlaps any solid cell.
     /// @param x Left edge in world pixels.
     /// @param y Top edge in world pixels.
@@ -87,15 +199,35 @@ class Tilemap {
     /// @brief Whether a level has been successfully loaded.
     [[nodiscard]] bool is_loaded() const { return loaded_; }
 
-    /// @brief Pre-baked tile render data.
+    /// @brief Pre-baked tile render data, grouped by chunk.
     [[nodiscard]] const std::vector<TileData>& tiles() const { return tiles_; }
 
     /// @brief Tileset texture (may be nullptr if not loaded via load()).
     [[nodiscard]] SDL_Texture* texture() const { return texture_; }
 
+    /// @brief Tileset's top-left in texture(); add it to TileData::src.
+    [[nodiscard]] SDL_Point texture_origin() const { return texture_origin_; }
+
+    /// @brief All tiles pre-drawn at world size with premultiplied alpha, or null.
+    [[nodiscard]] SDL_Texture* room_texture() const { return room_texture_; }
+
   private:
+    /// @brief Turn pixels_ into texture_, packing it into @p atlas when given.
+    bool upload_tileset(SDL_Renderer* renderer, TextureAtlas* atlas);
+
+    /// @brief Sort tiles_ by chunk (keeping draw order within each) and index them.
+    void build_chunks();
+
     SDL_Texture* texture_ = nullptr;
+    bool owns_texture_ = true;            ///< False when texture_ is a borrowed atlas page.
+    SDL_Point texture_origin_{};          ///< Tileset's top-left in texture_.
+    SDL_Texture* room_texture_ = nullptr; ///< Render target holding every tile (owned).
+    SDL_Surface* pixels_ = nullptr;       ///< Tileset decoded by parse(), freed by upload().
+    std::string tileset_path_;            ///< Tileset image, relative to the .ldtk file.
     std::vector<TileData> tiles_;
+    std::vector<uint32_t> chunk_offsets_; ///< Chunk i's tiles are [offsets[i], offsets[i + 1]).
+    int chunks_w_ = 0;
+    int chunks_h_ = 0;
     std::vector<bool> collision_grid_; ///< Row-major, true = solid.
     std::vector<SpawnPoint> spawns_;
     int width_px_ = 0;
@@ -106,4 +238,11 @@ class Tilemap {
     bool loaded_ = false;
 };
 
+/// @brief Where raven_bake_levels puts a level: "<ldtk dir>/baked/<level>.rlvl".
+/// @param ldtk_path Path to the .ldtk project file.
+/// @param level_name Name of the level.
+/// @return Path of the baked level.
+[[nodiscard]] std::string baked_level_path(const std::string& ldtk_path,
+                                           const std::string& level_name);
+
 } // namespace raven
@@ -0,0 +1,425 @@
+#include "rendering/tilemap.hpp"
+
+#include "core/asset_pack.hpp"
+
+#include <spdlog/spdlog.h>
+
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <variant>
+#include <vector>
+
+namespace raven {
+
+// Baked level layout (host byte order; the magic doubles as an endianness check):
+//
+//   Header   magic "RLVL", version,
+//            source size, source mtime (SDL_Time), source FNV-1a hash
+//   Level    width_px, height_px, cell_size, grid_w, grid_h, tileset path
+//   Tiles    count, then per tile: src x/y/w/h, dest_x, dest_y (i32), flags (u8)
+//   Grid     byte count, then grid_w * grid_h bits, row-major, LSB first
+//   Spawns   count, then per spawn: name, x, y, field count, fields
+//   Field    type tag, name, value (string, i32, f32, u8 bool or two f32)
+//
+// Strings are a u32 length followed by the bytes.
+
+namespace {
+
+constexpr char MAGIC[4] = {'R', 'L', 'V', 'L'};
+constexpr uint32_t VERSION = 3;
+
+/// @brief Bytes per baked tile: six i32 fields and the flags byte.
+constexpr size_t TILE_BYTES = 6 * sizeof(int32_t) + 1;
+
+/// @brief Bits of a baked tile's flags byte.
+constexpr uint8_t TILE_FLIP_X = 1 << 0;
+constexpr uint8_t TILE_FLIP_Y = 1 << 1;
+
+/// @brief Type tag of a baked spawn field, one per SpawnField alternative.
+enum class FieldType : uint8_t { String = 0, Int = 1, Float = 2, Bool = 3, Point = 4 };
+
+static_assert(sizeof(int) == 4, "level dimensions are baked as 32-bit ints");
+
+struct SourceStamp {
+    uint64_t size = 0;
+    int64_t mtime = 0;
+    uint64_t hash = 0;
+};
+
+uint64_t fnv1a64(const void* data, size_t size) {
+    const auto* bytes = static_cast<const uint8_t*>(data);
+    uint64_t hash = 14695981039346656037ull;
+    for (size_t i = 0; i < size; ++i) {
+        hash ^= bytes[i];
+        hash *= 1099511628211ull;
+    }
+    return hash;
+}
+
+/// @brief Size and modification time of @p path (hash left at 0).
+bool stat_source(const std::string& path, SourceStamp& stamp) {
+    SDL_PathInfo info;
+    if (!SDL_GetPathInfo(path.c_str(), &info) || info.type != SDL_PATHTYPE_FILE) {
+        return false;
+    }
+    stamp.size = info.size;
+    stamp.mtime = info.modify_time;
+    return true;
+}
+
+bool hash_source(const std::string& path, uint64_t& hash) {
+    size_t size = 0;
+    void* data = SDL_LoadFile(path.c_str(), &size);
+    if (!data) {
+        return false;
+    }
+    hash = fnv1a64(data, size);
+    SDL_free(data);
+    return true;
+}
+
+std::string directory_of(const std::string& path) {
+    auto last_slash = path.find_last_of('/');
+    return last_slash == std::string::npos ? std::string{} : path.substr(0, last_slash + 1);
+}
+
+class ByteWriter {
+  public:
+    template <typename T> void put(const T& value) { put_bytes(&value, sizeof(T)); }
+
+    void put_bytes(const void* data, size_t size) {
+        const auto* bytes = static_cast<const uint8_t*>(data);
+        out_.insert(out_.end(), bytes, bytes + size);
+    }
+
+    void put_string(const std::string& s) {
+        put(static_cast<uint32_t>(s.size()));
+        put_bytes(s.data(), s.size());
+    }
+
+    void put_tile(const TileData& tile) {
+        put(static_cast<int32_t>(tile.src.x));
+        put(static_cast<int32_t>(tile.src.y));
+        put(static_cast<int32_t>(tile.src.w));
+        put(static_cast<int32_t>(tile.src.h));
+        put(static_cast<int32_t>(tile.dest_x));
+        put(static_cast<int32_t>(tile.dest_y));
+        int flags = (tile.flip_x ? TILE_FLIP_X : 0) | (tile.flip_y ? TILE_FLIP_Y : 0);
+        put(static_cast<uint8_t>(flags));
+    }
+
+    void put_field(const std::string& name, const SpawnField& field) {
+        std::visit(
+            [&](const auto& value) {
+                using T = std::decay_t<decltype(value)>;
+                if constexpr (std::is_same_v<T, std::string>) {
+                    put(FieldType::String);
+                    put_string(name);
+                    put_string(value);
+                } else if constexpr (std::is_same_v<T, int>) {
+                    put(FieldType::Int);
+                    put_string(name);
+                    put(static_cast<int32_t>(value));
+                } else if constexpr (std::is_same_v<T, float>) {
+                    put(FieldType::Float);
+                    put_string(name);
+                    put(value);
+                } else if constexpr (std::is_same_v<T, bool>) {
+                    put(FieldType::Bool);
+                    put_string(name);
+                    put(static_cast<uint8_t>(value ? 1 : 0));
+                } else {
+                    put(FieldType::Point);
+                    put_string(name);
+                    put(value.x);
+                    put(value.y);
+                }
+            },
+            field);
+    }
+
+    [[nodiscard]] const std::vector<uint8_t>& bytes() const { return out_; }
+
+  private:
+    std::vector<uint8_t> out_;
+};
+
+/// @brief Bounds-checked reader; every get fails once the data runs out.
+class ByteReader {
+  public:
+    ByteReader(const void* data, size_t size)
+        : data_(static_cast<const uint8_t*>(data)), size_(size) {}
+
+    template <typename T> bool get(T& value) { return get_bytes(&value, sizeof(T)); }
+
+    bool get_bytes(void* out, size_t size) {
+        if (size > size_ - pos_) {
+            return false;
+        }
+        std::memcpy(out, data_ + pos_, size);
+        pos_ += size;
+        return true;
+    }
+
+    bool get_string(std::string& s) {
+        uint32_t length = 0;
+        if (!get(length) || length > size_ - pos_) {
+            return false;
+        }
+        s.assign(reinterpret_cast<const char*>(data_ + pos_), length);
+        pos_ += length;
+        return true;
+    }
+
+    bool get_tile(TileData& tile) {
+        int32_t fields[6] = {};
+        for (auto& f : fields) {
+            if (!get(f)) {
+                return false;
+            }
+        }
+        uint8_t flags = 0;
+        if (!get(flags) || (flags & ~(TILE_FLIP_X | TILE_FLIP_Y)) != 0) {
+            return false;
+        }
+        tile.src = {fields[0], fields[1], fields[2], fields[3]};
+        tile.dest_x = fields[4];
+        tile.dest_y = fields[5];
+        tile.flip_x = (flags & TILE_FLIP_X) != 0;
+        tile.flip_y = (flags & TILE_FLIP_Y) != 0;
+        return true;
+    }
+
+    bool get_field(FieldType type, SpawnField& field) {
+        switch (type) {
+        case FieldType::String: {
+            std::string value;
+            if (!get_string(value)) {
+                return false;
+            }
+            field = std::move(value);
+            return true;
+        }
+        case FieldType::Int: {
+            int32_t value = 0;
+            if (!get(value)) {
+                return false;
+            }
+            field = static_cast<int>(value);
+            return true;
+        }
+        case FieldType::Float: {
+            float value = 0.f;
+            if (!get(value)) {
+                return false;
+            }
+            field = value;
+            return true;
+        }
+        case FieldType::Bool: {
+            uint8_t value = 0;
+            if (!get(value) || value > 1) {
+                return false;
+            }
+            field = value != 0;
+            return true;
+        }
+        case FieldType::Point: {
+            SDL_FPoint value{};
+            if (!get(value.x) || !get(value.y)) {
+                return false;
+            }
+            field = value;
+            return true;
+        }
+        }
+        return false;
+    }
+
+    [[nodiscard]] size_t remaining() const { return size_ - pos_; }
+
+  private:
+    const uint8_t* data_;
+    size_t size_;
+    size_t pos_ = 0;
+};
+
+} // namespace
+
+std::string baked_level_path(const std::string& ldtk_path, const std::string& level_name) {
+    return directory_of(ldtk_path) + "baked/" + level_name + ".rlvl";
+}
+
+bool Tilemap::save_baked(const std::string& rlvl_path, const std::string& ldtk_path) const {
+    SourceStamp source;
+    if (!stat_source(ldtk_path, source) || !hash_source(ldtk_path, source.hash)) {
+        spdlog::error("Cannot stamp baked level: failed to read '{}'", ldtk_path);
+        return false;
+    }
+
+    ByteWriter w;
+    w.put_bytes(MAGIC, sizeof(MAGIC));
+    w.put(VERSION);
+    w.put(source.size);
+    w.put(source.mtime);
+    w.put(source.hash);
+
+    w.put(width_px_);
+    w.put(height_px_);
+    w.put(cell_size_);
+    w.put(grid_w_);
+    w.put(grid_h_);
+    w.put_string(tileset_path_);
+
+    w.put(static_cast<uint32_t>(tiles_.size()));
+    for (const auto& tile : tiles_) {
+        w.put_tile(tile);
+    }
+
+    std::vector<uint8_t> bits((collision_grid_.size() + 7) / 8, 0);
+    for (size_t i = 0; i < collision_grid_.size(); ++i) {
+        if (collision_grid_[i]) {
+            bits[i / 8] = static_cast<uint8_t>(bits[i / 8] | (1 << (i % 8)));
+        }
+    }
+    w.put(static_cast<uint32_t>(bits.size()));
+    w.put_bytes(bits.data(), bits.size());
+
+    w.put(static_cast<uint32_t>(spawns_.size()));
+    for (const auto& sp : spawns_) {
+        w.put_string(sp.name);
+        w.put(sp.x);
+        w.put(sp.y);
+        w.put(static_cast<uint32_t>(sp.fields.size()));
+        for (const auto& [name, value] : sp.fields) {
+            w.put_field(name, value);
+        }
+    }
+
+    const auto& bytes = w.bytes();
+    if (!SDL_SaveFile(rlvl_path.c_str(), bytes.data(), bytes.size())) {
+        spdlog::error("Failed to write baked level '{}': {}", rlvl_path, SDL_GetError());
+        return false;
+    }
+    return true;
+}
+
+bool Tilemap::load_baked(const std::string& rlvl_path, const std::string& ldtk_path) {
+    size_t size = 0;
+    void* data = assets::load_file(rlvl_path, &size);
+    if (!data) {
+        return false;
+    }
+
+    Tilemap baked;
+    bool ok = [&] {
+        ByteReader r(data, size);
+
+        char magic[4] = {};
+        uint32_t version = 0;
+        SourceStamp stamped;
+        if (!r.get_bytes(magic, sizeof(magic)) || std::memcmp(magic, MAGIC, sizeof(MAGIC)) != 0 ||
+            !r.get(version) || version != VERSION || !r.get(stamped.size) ||
+            !r.get(stamped.mtime) || !r.get(stamped.hash)) {
+            spdlog::info("Baked level '{}' is from another version, re-parsing", rlvl_path);
+            return false;
+        }
+
+        SourceStamp source;
+        if (stat_source(ldtk_path, source) &&
+            (source.size != stamped.size || source.mtime != stamped.mtime) &&
+            (!hash_source(ldtk_path, source.hash) || source.hash != stamped.hash)) {
+            spdlog::info("Baked level '{}' is stale, re-parsing '{}'", rlvl_path, ldtk_path);
+            return false;
+        }
+
+        int dims[5] = {};
+        for (auto& d : dims) {
+            if (!r.get(d)) {
+                return false;
+            }
+        }
+        baked.width_px_ = dims[0];
+        baked.height_px_ = dims[1];
+        baked.cell_size_ = dims[2];
+        baked.grid_w_ = dims[3];
+        baked.grid_h_ = dims[4];
+        if (baked.grid_w_ < 0 || baked.grid_h_ < 0 || !r.get_string(baked.tileset_path_)) {
+            return false;
+        }
+
+        uint32_t tile_count = 0;
+        if (!r.get(tile_count) || tile_count > r.remaining() / TILE_BYTES) {
+            return false;
+        }
+        baked.tiles_.resize(tile_count);
+        for (auto& tile : baked.tiles_) {
+            if (!r.get_tile(tile)) {
+                return false;
+            }
+        }
+
+        auto cells = static_cast<size_t>(baked.grid_w_) * static_cast<size_t>(baked.grid_h_);
+        uint32_t bit_bytes = 0;
+        if (!r.get(bit_bytes) || bit_bytes != (cells + 7) / 8 || bit_bytes > r.remaining()) {
+            return false;
+        }
+        std::vector<uint8_t> bits(bit_bytes);
+        r.get_bytes(bits.data(), bits.size());
+        baked.collision_grid_.resize(cells);
+        for (size_t i = 0; i < cells; ++i) {
+            baked.collision_grid_[i] = ((bits[i / 8] >> (i % 8)) & 1) != 0;
+        }
+
+        uint32_t spawn_count = 0;
+        if (!r.get(spawn_count)) {
+            return false;
+        }
+        baked.spawns_.reserve(std::min<size_t>(spawn_count, r.remaining()));
+        for (uint32_t s = 0; s < spawn_count; ++s) {
+            SpawnPoint sp;
+            uint32_t field_count = 0;
+            if (!r.get_string(sp.name) || !r.get(sp.x) || !r.get(sp.y) || !r.get(field_count)) {
+                return false;
+            }
+            for (uint32_t f = 0; f < field_count; ++f) {
+                FieldType type{};
+                std::string name;
+                SpawnField value;
+                if (!r.get(type) || !r.get_string(name) || !r.get_field(type, value)) {
+                    return false;
+                }
+                sp.fields.emplace(std::move(name), std::move(value));
+            }
+            baked.spawns_.push_back(std::move(sp));
+        }
+        return r.remaining() == 0;
+    }();
+    SDL_free(data);
+
+    if (!ok) {
+        spdlog::debug("Not using baked level '{}'", rlvl_path);
+        return false;
+    }
+
+    if (!baked.tileset_path_.empty()) {
+        std::string tex_path = directory_of(ldtk_path) + baked.tileset_path_;
+        baked.pixels_ = assets::load_surface(tex_path);
+        if (!baked.pixels_) {
+            spdlog::error("Failed to load tileset '{}': {}", tex_path, SDL_GetError());
+        }
+    }
+
+    baked.build_chunks();
+    baked.loaded_ = true;
+    *this = std::move(baked);
+    spdlog::info("Loaded baked level '{}': {}x{} px, {} tiles, {} spawns", rlvl_path, width_px_,
+                 height_px_, tiles_.size(), spawns_.size());
+    return true;
+}
+
+} // namespace raven
@@ -1,14 +1,69 @@
 #include "rendering/tilemap.hpp"
 
-#include <SDL3_image/SDL_image.h>
+#include "core/asset_pack.hpp"
+
 #include <spdlog/spdlog.h>
 
 #include <LDtkLoader/Project.hpp>
 
+#include <optional>
+
 namespace raven {
 
+namespace {
+
+/// @brief Read one entity field with its LDtk type; nullopt for null or unsupported types.
+/// @param cell Cell size of the entity layer, used to turn grid points into pixels.
+std::optional<SpawnField> read_field(const ldtk::Entity& entity, const ldtk::FieldDef& def,
+                                     float cell) {
+    switch (def.type) {
+    case ldtk::FieldType::String: {
+        const auto& field = entity.getField<std::string>(def.name);
+        return field.is_null() ? std::nullopt : std::optional<SpawnField>{field.value()};
+    }
+    case ldtk::FieldType::Int: {
+        const auto& field = entity.getField<int>(def.name);
+        return field.is_null() ? std::nullopt : std::optional<SpawnField>{field.value()};
+    }
+    case ldtk::FieldType::Float: {
+        const auto& field = entity.getField<float>(def.name);
+        return field.is_null() ? std::nullopt : std::optional<SpawnField>{field.value()};
+    }
+    case ldtk::FieldType::Bool: {
+        const auto& field = entity.getField<bool>(def.name);
+        return field.is_null() ? std::nullopt : std::optional<SpawnField>{field.value()};
+    }
+    case ldtk::FieldType::Point: {
+        const auto& field = entity.getField<ldtk::IntPoint>(def.name);
+        if (field.is_null()) {
+            return std::nullopt;
+        }
+        const auto& p = field.value();
+        return SDL_FPoint{(static_cast<float>(p.x) + 0.5f) * cell,
+                          (static_cast<float>(p.y) + 0.5f) * cell};
+    }
+    default:
+        return std::nullopt;
+    }
+}
+
+} // namespace
+
 bool Tilemap::load(SDL_Renderer* renderer, const std::string& ldtk_path,
-                   const std::string& level_name) {
+                   const std::string& level_name, TextureAtlas* atlas) {
+    bool parsed = parse(ldtk_path, level_name);
+    upload(renderer, atlas);
+    return parsed;
+}
+
+bool Tilemap::parse(const std::string& ldtk_path, const std::string& level_name) {
+    if (load_baked(baked_level_path(ldtk_path, level_name), ldtk_path)) {
+        return true;
+    }
+    return parse_ldtk(ldtk_path, level_name);
+}
+
+bool Tilemap::parse_ldtk(const std::string& ldtk_path, const std::string& level_name) {
     ldtk::Project project;
     try {
         project.loadFromFile(ldtk_path);
@@ -55,23 +110,17 @@ bool Tilemap::load(SDL_Renderer* renderer, const std::string& ldtk_path,
         auto layer_type = layer.getType();
 
         if (layer_type == ldtk::LayerType::Tiles || layer_type == ldtk::LayerType::AutoLayer) {
-            // Load tileset texture (first time only)
-            if (!texture_ && layer.hasTileset()) {
+            // Decode the tileset (first time only); upload() makes the texture
+            if (!pixels_ && layer.hasTileset()) {
                 const auto& tileset = layer.getTileset();
                 std::string tex_path = base_dir + tileset.path;
 
-                SDL_Surface* surface = IMG_Load(tex_path.c_str());
-                if (!surface) {
+                tileset_path_ = tileset.path;
+                pixels_ = assets::load_surface(tex_path);
+                if (!pixels_) {
                     spdlog::error("Failed to load tileset '{}': {}", tex_path, SDL_GetError());
                     continue;
                 }
-                texture_ = SDL_CreateTextureFromSurface(renderer, surface);
-                SDL_DestroySurface(surface);
-                if (!texture_) {
-                    spdlog::error("Failed to create tileset texture: {}", SDL_GetError());
-                    continue;
-                }
-                SDL_SetTextureScaleMode(texture_, SDL_SCALEMODE_PIXELART);
             }
 
             int cell = layer.getCellSize();
@@ -110,19 +159,14 @@ bool Tilemap::load(SDL_Renderer* renderer, const std::string& ldtk_path,
 
             // IntGrid layers can also have auto-tiles
             if (layer.hasTileset()) {
-                if (!texture_) {
+                if (!pixels_) {
                     const auto& tileset = layer.getTileset();
                     std::string tex_path = base_dir + tileset.path;
 
-                    SDL_Surface* surface = IMG_Load(tex_path.c_str());
-                    if (!surface) {
+                    tileset_path_ = tileset.path;
+                    pixels_ = assets::load_surface(tex_path);
+                    if (!pixels_) {
                         spdlog::error("Failed to load tileset '{}': {}", tex_path, SDL_GetError());
-                    } else {
-                        texture_ = SDL_CreateTextureFromSurface(renderer, surface);
-                        SDL_DestroySurface(surface);
-                        if (texture_) {
-                            SDL_SetTextureScaleMode(texture_, SDL_SCALEMODE_PIXELART);
-                        }
                     }
                 }
 
@@ -145,17 +189,15 @@ bool Tilemap::load(SDL_Renderer* renderer, const std::string& ldtk_path,
                 SpawnPoint sp{
                     entity.getName(), static_cast<float>(pos.x), static_cast<float>(pos.y), {}};
 
-                // Extract string fields from LDtk entity
+                // Extract scalar and point fields, keeping their LDtk types
+                const auto cell = static_cast<float>(layer.getCellSize());
                 for (const auto& field_def : entity.allFields()) {
-                    if (field_def.type == ldtk::FieldType::String) {
-                        try {
-                            const auto& field = entity.getField<std::string>(field_def.name);
-                            if (!field.is_null()) {
-                                sp.fields[field_def.name] = field.value();
-                            }
-                        } catch (...) {
-                            // Field access can throw on type mismatch; skip silently
+                    try {
+                        if (auto value = read_field(entity, field_def, cell)) {
+                            sp.fields.emplace(field_def.name, std::move(*value));
                         }
+                    } catch (...) {
+                        // Field access can throw on type mismatch; skip silently
                     }
                 }
 
@@ -164,6 +206,7 @@ bool Tilemap::load(SDL_Renderer* renderer, const std::string& ldtk_path,
         }
     }
 
+    build_chunks();
     loaded_ = true;
     spdlog::info("Loaded LDtk level '{}': {}x{} px, {} tiles, {} spawns, {}x{} collision grid",
                  level_name, width_px_, height_px_, tiles_.size(), spawns_.size(), grid_w_,
@@ -3,26 +3,18 @@
 #include "core/game.hpp"
 #include "core/paths.hpp"
 #include "core/string_id.hpp"
+#include "ecs/command_buffer.hpp"
 #include "ecs/components.hpp"
+#include "ecs/expiry_timers.hpp"
 #include "ecs/player_class.hpp"
-#include "ecs/systems/ai_system.hpp"
-#include "ecs/systems/animation_system.hpp"
-#include "ecs/systems/charged_shot_system.hpp"
-#include "ecs/systems/cleanup_system.hpp"
+#include "ecs/systems/bullet_motion.hpp"
+#include "ecs/systems/bullet_pool.hpp"
+#include "ecs/systems/camera_system.hpp"
 #include "ecs/systems/collision_system.hpp"
-#include "ecs/systems/concussion_shot_system.hpp"
-#include "ecs/systems/damage_system.hpp"
-#include "ecs/systems/dash_system.hpp"
-#include "ecs/systems/emitter_system.hpp"
-#include "ecs/systems/ground_slam_system.hpp"
+#include "ecs/systems/debug_draw_system.hpp"
+#include "ecs/systems/gameplay_schedule.hpp"
 #include "ecs/systems/hud_system.hpp"
-#include "ecs/systems/input_system.hpp"
-#include "ecs/systems/melee_system.hpp"
-#include "ecs/systems/movement_system.hpp"
-#include "ecs/systems/pickup_system.hpp"
 #include "ecs/systems/render_system.hpp"
-#include "ecs/systems/shooting_system.hpp"
-#include "ecs/systems/tile_collision_system.hpp"
 #include "ecs/systems/tilemap_render_system.hpp"
 #include "ecs/systems/wave_system.hpp"
 #include "scenes/game_over_scene.hpp"
@@ -33,10 +25,13 @@
 #include <spdlog/spdlog.h>
 
 #include <random>
+#include <utility>
 
 namespace raven {
 
-GameScene::GameScene(ClassId::Id player_class) : selected_class_(player_class) {}
+GameScene::GameScene(ClassId::Id player_class)
+    : selected_class_(player_class),
+      hud_layer_(Renderer::VIRTUAL_WIDTH, Renderer::VIRTUAL_HEIGHT) {}
 
 void GameScene::on_enter(Game& game) {
     spdlog::info("Entered game scene");
@@ -51,6 +46,27 @@ void GameScene::on_enter(Game& game) {
     game.registry().ctx().emplace<std::mt19937>(std::random_device{}());
     game.registry().ctx().emplace<AudioQueue>();
 
+    // Structural changes recorded by systems are applied once per tick
+    game.registry().ctx().emplace<CommandBuffer>();
+
+    // Lifetime/Invulnerable expire from a timer wheel instead of countdowns
+    enable_expiry_timers(game.registry(), game.clock().tick_count);
+
+    // Simulation tick for closed-form bullet motion (stops while paused)
+    game.registry().ctx().erase<SimTick>();
+    game.registry().ctx().emplace<SimTick>().tick = game.clock().tick_count;
+
+    // Systems split per-entity loops over the game's job system
+    game.registry().ctx().erase<JobSystem*>();
+    game.registry().ctx().emplace<JobSystem*>(&game.jobs());
+
+    // Bullets live in a flat SoA pool instead of the registry
+    game.registry().ctx().erase<systems::BulletPool>();
+    game.registry().ctx().emplace<systems::BulletPool>().reserve(4096);
+
+    // Sprite draw order persists across frames and is repaired, not re-sorted
+    systems::enable_sprite_order(game.registry());
+
     // Erase any stale GameState first: ctx().emplace is a no-op when the
     // value already exists, and the victory path (swap to TitleScene) does
     // not go through GameOverScene::on_exit, which normally erases it.
@@ -71,12 +87,28 @@ void GameScene::on_enter(Game& game) {
     } else {
         // Fallback: load the test room if no stages available
         tilemap_.load(game.renderer().sdl_renderer(), paths::asset("assets/maps/raven.ldtk"),
-                      "Test_Room");
+                      "Test_Room", &game.atlas());
+        ++tilemap_revision_;
+        auto [world_w, world_h] = level_size();
+        systems::configure_camera(game.registry(), world_w, world_h);
     }
+
+    room_target_generation_ = game.renderer().target_generation();
+
+    // Declare system accesses against the ctx set up above
+    frame_.patterns = &pattern_lib_;
+    frame_.tilemap = &tilemap_;
+    scheduler_.set_jobs(&game.jobs());
+    systems::build_gameplay_schedule(scheduler_, game.registry(), frame_);
+
+    // The first frame renders before any tick has run
+    publish_snapshot(game);
 }
 
 void GameScene::on_exit(Game& game) {
     game.registry().clear();
+    disable_expiry_timers(game.registry());
+    systems::disable_sprite_order(game.registry());
     spdlog::info("Exited game scene");
 }
 
@@ -127,12 +159,22 @@ void GameScene::spawn_player(Game& game) {
 void GameScene::enter_room(Game& game, const std::string& level) {
     clear_room_entities(game);
 
-    // Reload tilemap
-    tilemap_ = Tilemap{};
-    tilemap_.load(game.renderer().sdl_renderer(), paths::asset("assets/maps/raven.ldtk"), level);
+    // Swap in the prefetched tilemap; parse here only if the prefetch missed
+    if (auto ready = next_room_.take(level)) {
+        tilemap_ = std::move(*ready);
+    } else {
+        tilemap_ = Tilemap{};
+        tilemap_.parse(paths::asset("assets/maps/raven.ldtk"), level);
+    }
+    tilemap_.upload(game.renderer().sdl_renderer(), &game.atlas());
+    ++tilemap_revision_;
 
-    // Reposition player to PlayerStart
+    // Size the collision broad-phase to the level
     auto& reg = game.registry();
+    auto [world_w, world_h] = level_size();
+    systems::configure_collision_bounds(reg, world_w, world_h);
+
+    // Reposition player to PlayerStart
     auto player_view = reg.view<Player, Transform2D, PreviousTransform>();
     for (auto [entity, player, tf, prev] : player_view.each()) {
         float spawn_x = static_cast<float>(Renderer::VIRTUAL_WIDTH) / 2.f;
@@ -147,13 +189,15 @@ void GameScene::enter_room(Game& game, const std::string& level) {
         prev.y = spawn_y;
     }
 
+    // Start the view on the player rather than scrolling over from the last room
+    systems::configure_camera(reg, world_w, world_h);
+
     // Spawn Exit entities from tilemap
     auto exit_spawns = tilemap_.find_all_spawns("Exit");
     for (const auto* sp : exit_spawns) {
         std::string target;
-        auto it = sp->fields.find("target_level");
-        if (it != sp->fields.end()) {
-            target = it->second;
+        if (const auto* level = sp->field<std::string>("target_level")) {
+            target = *level;
         }
 
         auto exit_entity = reg.create();
@@ -175,109 +219,71 @@ void GameScene::enter_room(Game& game, const std::string& level) {
     }
 
     spdlog::info("Entered room '{}'", level);
+
+    prefetch_next_room();
+}
+
+std::pair<float, float> GameScene::level_size() const {
+    if (tilemap_.is_loaded() && tilemap_.width_px() > 0 && tilemap_.height_px() > 0) {
+        return {static_cast<float>(tilemap_.width_px()), static_cast<float>(tilemap_.height_px())};
+    }
+    return {static_cast<float>(Renderer::VIRTUAL_WIDTH),
+            static_cast<float>(Renderer::VIRTUAL_HEIGHT)};
+}
+
+void GameScene::prefetch_next_room() {
+    const auto* next = stage_loader_.get(current_stage_ + 1);
+    if (!next || next_room_.pending(next->level)) {
+        return;
+    }
+
+    next_room_.start(next->level, [path = paths::asset("assets/maps/raven.ldtk"),
+                                   level = next->level] {
+        Tilemap tilemap;
+        tilemap.parse(path, level);
+        return tilemap;
+    });
 }
 
 void GameScene::clear_room_entities(Game& game) {
     auto& reg = game.registry();
 
-    // Destroy all entities except the player
-    std::vector<entt::entity> to_destroy;
+    // Destroy all entities except the player, storage by storage
+    CommandBuffer cmds;
     auto& entities = reg.storage<entt::entity>();
     for (auto entity : entities) {
         if (reg.valid(entity) && !reg.any_of<Player>(entity)) {
-            to_destroy.push_back(entity);
+            cmds.destroy(entity);
         }
     }
-    for (auto entity : to_destroy) {
-        if (reg.valid(entity)) {
-            reg.destroy(entity);
-        }
+    cmds.flush(reg);
+
+    if (auto* pool = reg.ctx().find<systems::BulletPool>()) {
+        pool->clear();
     }
 }
 
 void GameScene::update(Game& game, float dt) {
+    // Hold still until sync() has loaded the next room
+    if (room_change_pending_) {
+        return;
+    }
+
     auto& reg = game.registry();
     auto& input = game.input().state();
 
-    // Run ECS systems in order
-    systems::update_charged_shot(reg, input, dt);
-    systems::update_input(reg, input, dt);
-    systems::update_melee(reg, input, pattern_lib_, dt);
-    systems::update_dash(reg, input, dt);
-    systems::update_ground_slam(reg, input, dt);
-    systems::update_concussion_shot(reg, input, dt);
-    systems::update_shooting(reg, input, dt);
-    systems::update_emitters(reg, pattern_lib_, dt);
-    systems::update_ai(reg, tilemap_, dt);
-
-    // Animation state switching (priority: Melee > Dash > Walk > Idle)
-    auto anim_view = reg.view<Player, Velocity, Animation, Sprite, AnimationState>();
-    for (auto [entity, player, vel, anim, sprite, state] : anim_view.each()) {
-        AnimationState::State desired;
-        if (reg.any_of<MeleeAttack>(entity) || reg.any_of<GroundSlam>(entity)) {
-            desired = AnimationState::State::Melee;
-        } else if (reg.any_of<Dash>(entity)) {
-            desired = AnimationState::State::Dash;
-        } else if ((vel.dx * vel.dx + vel.dy * vel.dy) > 1.f) {
-            desired = AnimationState::State::Walk;
-        } else {
-            desired = AnimationState::State::Idle;
-        }
+    ++reg.ctx().get<SimTick>().tick;
 
-        if (state.current != desired) {
-            state.current = desired;
-            switch (desired) {
-            case AnimationState::State::Melee:
-                sprite.frame_y = 1;
-                anim.start_frame = 0;
-                anim.end_frame = 2;
-                anim.frame_duration = 0.05f;
-                anim.looping = false;
-                break;
-            case AnimationState::State::Dash:
-                sprite.frame_y = 1;
-                anim.start_frame = 0;
-                anim.end_frame = 2;
-                anim.frame_duration = 0.04f;
-                anim.looping = false;
-                break;
-            case AnimationState::State::Walk:
-                sprite.frame_y = 1;
-                anim.start_frame = 0;
-                anim.end_frame = 5;
-                anim.frame_duration = 0.1f;
-                anim.looping = true;
-                break;
-            case AnimationState::State::Idle:
-                sprite.frame_y = 0;
-                anim.start_frame = 0;
-                anim.end_frame = 3;
-                anim.frame_duration = 0.25f;
-                anim.looping = true;
-                break;
-            }
-            anim.current_frame = anim.start_frame;
-            anim.elapsed = 0.f;
-        }
+    // Run ECS systems (independent ones overlap; see build_gameplay_schedule)
+    frame_.input = &input;
+    frame_.dt = dt;
+    scheduler_.run();
 
-        // Flip sprite to face aim direction
-        if (auto* aim = reg.try_get<AimDirection>(entity)) {
-            if (aim->x > 0.f)
-                sprite.flip_x = false;
-            else if (aim->x < 0.f)
-                sprite.flip_x = true;
-        }
+    // Sync point: apply deferred destroys/emplaces before wave bookkeeping
+    if (auto* commands = reg.ctx().find<CommandBuffer>()) {
+        commands->flush(reg);
     }
 
-    systems::update_animation(reg, dt);
-    systems::update_movement(reg, dt);
-    systems::update_tile_collision(reg, tilemap_);
-    systems::update_collision(reg);
-    systems::update_pickups(reg);
-    systems::update_weapon_decay(reg, dt);
-    systems::update_damage(reg, pattern_lib_, dt);
-    systems::update_cleanup(reg, dt, Renderer::VIRTUAL_WIDTH, Renderer::VIRTUAL_HEIGHT);
-
     // Wave clear check + next wave spawn
     const auto* stage = stage_loader_.get(current_stage_);
     if (stage) {
@@ -292,17 +298,13 @@ void GameScene::update(Game& game, float dt) {
         audio_queue->events.clear();
     }
 
-    // Exit overlap check — room transition
+    publish_snapshot(game);
+
+    // Exit overlap check — room transition. Loading the room creates
+    // textures, so it happens in sync() on the main thread.
     auto target = systems::check_exit_overlap(reg);
     if (!target.empty()) {
-        current_stage_++;
-        const auto* next = stage_loader_.get(current_stage_);
-        if (next) {
-            enter_room(game, next->level);
-        } else {
-            // Final stage cleared
-            game.scenes().swap(std::make_unique<VictoryScene>(), game);
-        }
+        room_change_pending_ = true;
         return;
     }
 
@@ -320,6 +322,51 @@ void GameScene::update(Game& game, float dt) {
     }
 }
 
+void GameScene::sync(Game& game) {
+    if (!room_change_pending_) {
+        return;
+    }
+    room_change_pending_ = false;
+
+    current_stage_++;
+    const auto* next = stage_loader_.get(current_stage_);
+    if (next) {
+        enter_room(game, next->level);
+        // Older snapshots reference the previous room's tileset texture
+        publish_snapshot(game);
+    } else {
+        // Final stage cleared
+        game.scenes().swap(std::make_unique<VictoryScene>(), game);
+    }
+}
+
+void GameScene::publish_snapshot(Game& game) {
+    auto& reg = game.registry();
+    auto& snapshot = snapshots_.write_buffer();
+    snapshot.tick = current_sim_tick(reg);
+
+    SDL_FRect view{0.f, 0.f, static_cast<float>(Renderer::VIRTUAL_WIDTH),
+                   static_cast<float>(Renderer::VIRTUAL_HEIGHT)};
+    snapshot.camera_prev = {};
+    snapshot.camera = {};
+    if (const auto* camera = reg.ctx().find<Camera>()) {
+        view = {camera->x, camera->y, camera->width, camera->height};
+        snapshot.camera_prev = {camera->prev_x, camera->prev_y};
+        snapshot.camera = {camera->x, camera->y};
+    }
+    systems::extract_tiles(tilemap_, tilemap_revision_, view, snapshot);
+    systems::extract_sprites(reg, game.sprites(), snapshot.sprites);
+    systems::extract_debug_draw(reg, tilemap_, snapshot.debug);
+
+    // Each slot copies the HUD only when it changed since that slot was written
+    systems::update_hud(reg, game.font(), hud_);
+    if (snapshot.hud_version != hud_.version) {
+        snapshot.hud = hud_.items;
+        snapshot.hud_version = hud_.version;
+    }
+    snapshots_.publish();
+}
+
 void GameScene::render(Game& game) {
     auto* r = game.renderer().sdl_renderer();
 
@@ -327,21 +374,26 @@ void GameScene::render(Game& game) {
     SDL_SetRenderDrawColor(r, 8, 8, 24, 255);
     SDL_RenderClear(r);
 
-    // Render tilemap as background layer
-    systems::render_tilemap(tilemap_, r);
+    // A target reset may have wiped the baked room. Rebaking replaces the
+    // room texture the ticks copy into snapshots, so join them first, then
+    // publish a snapshot under a new revision: the cached tile quads may
+    // still point at the texture bake() just destroyed.
+    if (room_target_generation_ != game.renderer().target_generation()) {
+        room_target_generation_ = game.renderer().target_generation();
+        game.wait_for_simulation();
+        tilemap_.bake(r);
+        ++tilemap_revision_;
+        publish_snapshot(game);
+        hud_layer_.invalidate();
+    }
 
-    // Render all sprites via ECS (interpolated). While an overlay (pause)
-    // is on top, this scene no longer ticks, so snap to current positions —
-    // a varying alpha would make sprites shimmer between prev and current.
+    // Tiles, interpolated sprites and HUD from the newest tick. While an
+    // overlay (pause) is on top, this scene no longer ticks, so snap to
+    // current positions — a varying alpha would make sprites shimmer
+    // between prev and current.
     float alpha = game.scenes().is_top(this) ? game.clock().interpolation_alpha : 1.f;
-    systems::render_sprites(game.registry(), r, game.sprites(), alpha);
-
-    // HUD overlay
-    render_hud(game);
-}
-
-void GameScene::render_hud(Game& game) {
-    systems::render_hud(game.registry(), game.renderer().sdl_renderer(), game.font());
+    draw_render_snapshot(snapshots_.read_buffer(), r, game.renderer().queue(), game.font(),
+                         hud_layer_, alpha);
 }
 
 } // namespace raven
@@ -1,12 +1,20 @@
 #pragma once
 
+#include "core/prefetch.hpp"
+#include "core/triple_buffer.hpp"
 #include "ecs/components.hpp"
+#include "ecs/systems/gameplay_schedule.hpp"
+#include "ecs/systems/hud_system.hpp"
 #include "ecs/systems/wave_system.hpp"
 #include "patterns/pattern_library.hpp"
+#include "rendering/hud_layer.hpp"
+#include "rendering/render_snapshot.hpp"
 #include "rendering/tilemap.hpp"
 #include "scenes/scene.hpp"
 
+#include <cstdint>
 #include <string>
+#include <utility>
 
 namespace raven {
 
@@ -30,33 +38,59 @@ class GameScene : public Scene {
     /// @param dt Fixed timestep delta in seconds.
     void update(Game& game, float dt) override;
 
-    /// @brief Render all gameplay entities via the render system.
+    /// @brief Draw the newest published RenderSnapshot.
     /// @param game The Game instance.
     void render(Game& game) override;
 
+    /// @brief Load the next room (or swap to victory) once an exit was reached.
+    /// @param game The Game instance.
+    void sync(Game& game) override;
+
+    /// @brief Gameplay ticks only touch the registry and publish snapshots.
+    [[nodiscard]] bool concurrent_update() const override { return true; }
+
   private:
     /// @brief Create the player entity with all required components.
     /// @param game The Game instance providing registry and sprite access.
     void spawn_player(Game& game);
 
     /// @brief Enter a new room: clear non-player entities, reload tilemap, spawn exits and wave 0.
+    ///
+    /// Takes the prefetched Tilemap when it matches @p level (only the texture
+    /// upload is left), then starts prefetching the next stage's level.
     /// @param game The Game instance.
     /// @param level LDtk level name to load.
     void enter_room(Game& game, const std::string& level);
 
+    /// @brief Size of the current level in pixels, or of the virtual screen
+    /// when no level is loaded.
+    [[nodiscard]] std::pair<float, float> level_size() const;
+
+    /// @brief Start parsing the level of the stage after the current one.
+    void prefetch_next_room();
+
     /// @brief Destroy all entities except the player.
     /// @param game The Game instance.
     void clear_room_entities(Game& game);
 
-    /// @brief Render the HUD overlay (health, lives, score, decay timer, wave indicator).
+    /// @brief Extract tiles, sprites and HUD into the snapshot buffer and publish it.
     /// @param game The Game instance.
-    void render_hud(Game& game);
+    void publish_snapshot(Game& game);
 
-    ClassId::Id selected_class_; ///< Player class chosen at character select.
-    Tilemap tilemap_;            ///< Tilemap loaded from LDtk for the current room.
-    PatternLibrary pattern_lib_; ///< Bullet pattern definitions for enemy emitters.
-    StageLoader stage_loader_;   ///< Loaded stage definitions.
-    int current_stage_ = 0;      ///< Index of the current stage being played.
+    ClassId::Id selected_class_;             ///< Player class chosen at character select.
+    Tilemap tilemap_;                        ///< Tilemap loaded from LDtk for the current room.
+    Prefetch<Tilemap> next_room_;            ///< Next stage's level, parsed in the background.
+    PatternLibrary pattern_lib_;             ///< Bullet pattern definitions for enemy emitters.
+    StageLoader stage_loader_;               ///< Loaded stage definitions.
+    int current_stage_ = 0;                  ///< Index of the current stage being played.
+    SystemScheduler scheduler_;              ///< Per-tick gameplay systems (built in on_enter).
+    systems::GameplayFrame frame_;           ///< Inputs the scheduled systems read each tick.
+    TripleBuffer<RenderSnapshot> snapshots_; ///< Ticks publish, render() reads the newest.
+    systems::RetainedHud hud_;               ///< HUD as of the last tick (simulation side).
+    HudLayer hud_layer_;                     ///< Cached HUD texture (main thread).
+    uint64_t tilemap_revision_ = 0;          ///< Bumped on every tilemap load or rebake.
+    uint64_t room_target_generation_ = 0;    ///< Renderer target generation the room was baked at.
+    bool room_change_pending_ = false;       ///< Exit reached; sync() loads the next room.
 };
 
 } // namespace raven
@@ -29,15 +29,32 @@ class Scene {
     /// @brief Render the scene for the current frame.
     /// @param game The Game instance providing access to subsystems.
     virtual void render(Game& game) = 0;
+
+    /// @brief Called on the main thread after each batch of fixed ticks.
+    ///
+    /// No update() is running. Do work requested during update() that must
+    /// happen on the main thread here, e.g. creating SDL textures.
+    /// @param game The Game instance providing access to subsystems.
+    virtual void sync(Game& game) { (void)game; }
+
+    /// @brief Whether update() may run on the simulation thread while the
+    /// main thread renders and presents.
+    ///
+    /// Only true for scenes whose update() touches no SDL or main-thread
+    /// state and whose render() reads nothing update() writes (GameScene
+    /// renders from a published RenderSnapshot).
+    [[nodiscard]] virtual bool concurrent_update() const { return false; }
 };
 
 /// @brief Stack-based scene manager. The top scene receives updates and renders.
 ///
 /// Supports push (for overlays like pause menus) and swap (for transitions).
 ///
-/// Transitions requested from inside a scene's update() are deferred and
-/// applied after the update returns — popping a scene destroys it, so
-/// applying immediately would free the scene that is still executing.
+/// Transitions requested from inside a scene's update() are deferred to
+/// sync(), which Game calls on the main thread after each batch of ticks —
+/// popping a scene destroys it, so applying immediately would free the
+/// scene that is still executing, and the update may be running on the
+/// simulation thread while render() walks the stack.
 class SceneManager {
   public:
     /// @brief Push a scene onto the stack, becoming the active scene.
@@ -62,10 +79,24 @@ class SceneManager {
     void clear(Game& game);
 
     /// @brief Update the top scene.
+    ///
+    /// Skipped while a transition is waiting for sync(), so the outgoing
+    /// scene does not tick (and re-request it) for the rest of the batch.
     /// @param game The Game instance.
     /// @param dt Fixed timestep delta in seconds.
     void update(Game& game, float dt);
 
+    /// @brief Run the top scene's sync(), then apply deferred transitions.
+    ///
+    /// Main thread only, with no update() in flight.
+    /// @param game The Game instance.
+    void sync(Game& game);
+
+    /// @brief Whether the top scene allows update() to overlap rendering.
+    [[nodiscard]] bool concurrent_update() const {
+        return !stack_.empty() && pending_.empty() && stack_.back()->concurrent_update();
+    }
+
     /// @brief Render the top scene.
     /// @param game The Game instance.
     void render(Game& game);
@@ -94,7 +125,7 @@ class SceneManager {
 
     std::vector<std::unique_ptr<Scene>> stack_;
     std::vector<PendingOp> pending_;
-    bool updating_ = false; ///< True while the top scene's update() runs.
+    bool updating_ = false; ///< True while the top scene's update() or sync() runs.
 };
 
 } // namespace raven
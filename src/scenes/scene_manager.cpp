@@ -39,11 +39,20 @@ void SceneManager::clear(Game& game) {
 }
 
 void SceneManager::update(Game& game, float dt) {
-    if (!stack_.empty()) {
+    if (!stack_.empty() && pending_.empty()) {
         updating_ = true;
         stack_.back()->update(game, dt);
         updating_ = false;
     }
+}
+
+void SceneManager::sync(Game& game) {
+    // Transitions requested from sync() queue up too and apply below
+    if (!stack_.empty()) {
+        updating_ = true;
+        stack_.back()->sync(game);
+        updating_ = false;
+    }
 
     // Apply transitions requested during update. Move the queue out first:
     // on_enter/on_exit may request further transitions, which now apply
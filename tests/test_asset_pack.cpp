@@ -0,0 +1,96 @@
+#include "core/asset_pack.hpp"
+
+#include <SDL3/SDL.h>
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+
+using namespace raven;
+
+TEST_CASE("AssetPack round trip", "[assets]") {
+    const std::string path = "test_pack_tmp.rpak";
+
+    AssetPackWriter writer;
+    const char wav[] = "RIFF....WAVE";
+    writer.add_raw("assets/audio/sfx/hit.wav", wav, sizeof(wav));
+    writer.add_json("assets/data/config.json", {{"font", {{"glyph_w", 6}}}});
+    writer.add_json("assets/data/stale.json", {{"v", 1}});
+    writer.add_json("assets/data/stale.json", {{"v", 2}});
+
+    SDL_Surface* image = SDL_CreateSurface(3, 2, SDL_PIXELFORMAT_RGBA32);
+    REQUIRE(image != nullptr);
+    std::memset(image->pixels, 0x7f, static_cast<size_t>(image->pitch) * 2);
+    REQUIRE(writer.add_pixels("assets/sprites/dot.png", image));
+    SDL_DestroySurface(image);
+
+    REQUIRE(writer.write(path));
+
+    SECTION("Entries are found by name and aligned") {
+        AssetPack pack;
+        REQUIRE(pack.open(path));
+        REQUIRE(pack.entry_count() == 4);
+
+        auto raw = pack.find("assets/audio/sfx/hit.wav");
+        REQUIRE(raw);
+        REQUIRE(raw->kind == AssetKind::Raw);
+        REQUIRE(raw->size == sizeof(wav));
+        REQUIRE(std::memcmp(raw->data, wav, sizeof(wav)) == 0);
+        REQUIRE(reinterpret_cast<uintptr_t>(raw->data) % AssetPack::ALIGNMENT == 0);
+
+        REQUIRE_FALSE(pack.find("assets/audio/sfx/miss.wav"));
+        REQUIRE_FALSE(pack.find("hit.wav"));
+    }
+
+    SECTION("Mounted pack serves JSON and pixels") {
+        REQUIRE(assets::mount(path));
+
+        nlohmann::json config;
+        REQUIRE(assets::load_json("assets/data/config.json", config));
+        REQUIRE(config["font"]["glyph_w"] == 6);
+
+        nlohmann::json stale;
+        REQUIRE(assets::load_json("assets/data/stale.json", stale));
+        REQUIRE(stale["v"] == 2); // last add wins
+
+        SDL_Surface* dot = assets::load_surface("assets/sprites/dot.png");
+        REQUIRE(dot != nullptr);
+        REQUIRE(dot->w == 3);
+        REQUIRE(dot->h == 2);
+        REQUIRE(static_cast<const uint8_t*>(dot->pixels)[0] == 0x7f);
+        SDL_DestroySurface(dot);
+
+        assets::unmount();
+    }
+
+    SECTION("Loose files are read when the pack lacks them") {
+        const std::string loose = "test_pack_loose_tmp.json";
+        {
+            std::ofstream f(loose);
+            f << R"({"loose": true})";
+        }
+        REQUIRE(assets::mount(path));
+
+        nlohmann::json j;
+        REQUIRE(assets::load_json(loose, j));
+        REQUIRE(j["loose"] == true);
+        REQUIRE_FALSE(assets::load_json("nonexistent_dir/missing.json", j));
+
+        assets::unmount();
+        std::remove(loose.c_str());
+    }
+
+    SECTION("Corrupt packs are rejected") {
+        {
+            std::ofstream f(path, std::ios::binary | std::ios::trunc);
+            f << "RPAK";
+        }
+        AssetPack pack;
+        REQUIRE_FALSE(pack.open(path));
+        REQUIRE_FALSE(pack.is_open());
+    }
+
+    std::remove(path.c_str());
+}
@@ -16,6 +16,7 @@ TEST_CASE("AudioEngine is safe when uninitialised", "[audio]") {
 
     // All calls must no-op, not crash
     REQUIRE_FALSE(engine.load_sound("shoot", "nonexistent.wav"));
+    REQUIRE_FALSE(engine.add_sound("shoot", {}));
     engine.play("shoot");
     engine.update();
     engine.set_master_gain(0.5f);
@@ -44,6 +45,12 @@ TEST_CASE("AudioEngine with dummy driver", "[audio]") {
         REQUIRE_FALSE(engine.load_sound("ghost", "no/such/file.wav"));
     }
 
+    SECTION("Decoding needs no device and leaves nothing to free on failure") {
+        AudioEngine::Sound sound;
+        REQUIRE_FALSE(AudioEngine::decode_sound("no/such/file.wav", sound));
+        REQUIRE(sound.data == nullptr);
+    }
+
     engine.shutdown();
     REQUIRE_FALSE(engine.is_ready());
 }
@@ -2,6 +2,8 @@
 
 #include <catch2/catch_test_macros.hpp>
 
+#include <string>
+
 using namespace raven;
 
 TEST_CASE("Font glyph index mapping", "[font]") {
@@ -52,3 +54,32 @@ TEST_CASE("Font measure scales with text length and scale", "[font]") {
     // The formula itself: length x glyph_w x scale (documented contract)
     // is exercised end-to-end by draw_centered in the game.
 }
+
+TEST_CASE("Text runs are cached per string, scale and colour", "[font]") {
+    // push() never dereferences the texture, so any address will do
+    static char page;
+    BitmapFont font;
+    font.attach({reinterpret_cast<SDL_Texture*>(&page), {16, 32, 96, 48}}, 6, 8);
+    RenderQueue queue;
+
+    font.push(queue, 0, "GO GO", 10.f, 20.f);
+    REQUIRE(queue.size() == 4); // the space has no quad
+    REQUIRE(font.cached_runs() == 1);
+
+    font.push(queue, 0, "GO GO", 50.f, 20.f);
+    REQUIRE(font.cached_runs() == 1);
+    font.push(queue, 0, "GO GO", 10.f, 20.f, {255, 0, 0, 255});
+    font.push(queue, 0, "GO GO", 10.f, 20.f, {255, 255, 255, 255}, 2);
+    REQUIRE(font.cached_runs() == 3);
+
+    // Least recently used runs are evicted past the cap
+    for (size_t i = 0; i < BitmapFont::MAX_RUNS; ++i) {
+        font.push(queue, 0, std::to_string(i), 0.f, 0.f);
+    }
+    REQUIRE(font.cached_runs() == BitmapFont::MAX_RUNS);
+
+    // A new atlas region invalidates every glyph rect
+    font.attach({reinterpret_cast<SDL_Texture*>(&page), {0, 0, 96, 48}}, 6, 8);
+    REQUIRE(font.cached_runs() == 0);
+    queue.flush(nullptr);
+}
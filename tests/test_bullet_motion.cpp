@@ -0,0 +1,140 @@
+#include "core/string_id.hpp"
+#include "ecs/components.hpp"
+#include "ecs/systems/bullet_motion.hpp"
+#include "ecs/systems/bullet_pool.hpp"
+#include "ecs/systems/bullet_spawn.hpp"
+#include "ecs/systems/emitter_system.hpp"
+#include "patterns/pattern_library.hpp"
+
+#include <entt/entt.hpp>
+
+#include <catch2/catch_approx.hpp>
+#include <catch2/catch_test_macros.hpp>
+
+#include <cmath>
+#include <initializer_list>
+
+using namespace raven;
+using Catch::Approx;
+
+TEST_CASE("Closed-form bullet motion", "[bullet_motion]") {
+    BulletMotion motion;
+    motion.origin_x = 10.f;
+    motion.origin_y = 20.f;
+    motion.dir_x = 0.6f;
+    motion.dir_y = 0.8f;
+    motion.speed = 100.f;
+
+    SECTION("Straight motion moves at constant speed") {
+        auto s = systems::evaluate_motion(motion, 1.f);
+        REQUIRE(s.x == Approx(70.f));
+        REQUIRE(s.y == Approx(100.f));
+        REQUIRE(s.vx == Approx(60.f));
+        REQUIRE(s.vy == Approx(80.f));
+    }
+
+    SECTION("Acceleration follows v t + a t^2 / 2") {
+        motion.acceleration = 50.f;
+        auto s = systems::evaluate_motion(motion, 2.f);
+        float dist = 100.f * 2.f + 0.5f * 50.f * 4.f;
+        REQUIRE(s.x == Approx(10.f + 0.6f * dist));
+        REQUIRE(s.y == Approx(20.f + 0.8f * dist));
+        REQUIRE(std::hypot(s.vx, s.vy) == Approx(200.f));
+    }
+
+    SECTION("Deceleration stops a bullet instead of reversing it") {
+        motion.acceleration = -50.f;
+        // Speed reaches zero at t = 2, after 100 * 2 - 25 * 4 = 100 px
+        for (float t : {2.f, 3.f, 10.f}) {
+            auto s = systems::evaluate_motion(motion, t);
+            REQUIRE(s.x == Approx(10.f + 0.6f * 100.f));
+            REQUIRE(s.y == Approx(20.f + 0.8f * 100.f));
+            REQUIRE(s.vx == Approx(0.f).margin(1e-4));
+            REQUIRE(s.vy == Approx(0.f).margin(1e-4));
+        }
+
+        motion.angular_velocity = 1.f;
+        auto stopped = systems::evaluate_motion(motion, 2.f);
+        auto later = systems::evaluate_motion(motion, 6.f);
+        REQUIRE(later.x == Approx(stopped.x));
+        REQUIRE(later.y == Approx(stopped.y));
+        REQUIRE(std::hypot(later.vx, later.vy) == Approx(0.f).margin(1e-4));
+    }
+
+    SECTION("Constant turn rate traces a circle") {
+        motion.angular_velocity = 2.f;
+        float radius = motion.speed / motion.angular_velocity;
+        float cx = motion.origin_x - motion.dir_y * radius;
+        float cy = motion.origin_y + motion.dir_x * radius;
+        for (float t : {0.25f, 1.f, 2.5f}) {
+            auto s = systems::evaluate_motion(motion, t);
+            REQUIRE(std::hypot(s.x - cx, s.y - cy) == Approx(radius).margin(0.01));
+            REQUIRE(std::hypot(s.vx, s.vy) == Approx(100.f));
+        }
+    }
+
+    SECTION("motion_time counts whole ticks plus a fraction") {
+        motion.spawn_tick = 10;
+        REQUIRE(systems::motion_time(motion, 10, 1.f) == Approx(Clock::TICK_RATE));
+        REQUIRE(systems::motion_time(motion, 13, 0.5f) == Approx(3.5f * Clock::TICK_RATE));
+        REQUIRE(systems::motion_time(motion, 5, 0.5f) == Approx(0.f));
+    }
+}
+
+TEST_CASE("Emitter bullets use closed-form motion", "[bullet_motion][emitters]") {
+    entt::registry reg;
+    auto& interner = reg.ctx().emplace<StringInterner>();
+    reg.ctx().emplace<SimTick>().tick = 42;
+    PatternLibrary patterns;
+    patterns.set_interner(interner);
+
+    nlohmann::json j = {{"name", "curve"},
+                        {"emitters",
+                         {{{"type", "radial"},
+                           {"count", 1},
+                           {"fire_rate", 0.05f},
+                           {"bullet_angular_velocity", 90.f},
+                           {"bullet_acceleration", -20.f}}}}};
+    REQUIRE(patterns.load_from_json(j));
+    REQUIRE(patterns.get("curve")->emitters[0].bullet_acceleration == Approx(-20.f));
+
+    auto enemy = reg.create();
+    reg.emplace<Transform2D>(enemy, 50.f, 60.f);
+    BulletEmitter emitter;
+    emitter.pattern_name = interner.intern("curve");
+    reg.emplace<BulletEmitter>(enemy, std::move(emitter));
+
+    // Cooldown starts charged: one burst after 0.05 s (6 ticks), none before 12
+    for (int i = 0; i < 8; ++i) {
+        systems::update_emitters(reg, patterns, 1.f / 120.f);
+    }
+
+    int count = 0;
+    auto view = reg.view<Bullet, BulletMotion>();
+    for (auto [entity, bullet, motion] : view.each()) {
+        ++count;
+        REQUIRE_FALSE(reg.all_of<PreviousTransform>(entity));
+        REQUIRE(reg.all_of<Velocity>(entity));
+        REQUIRE(motion.spawn_tick == 42);
+        REQUIRE(motion.origin_x == Approx(50.f));
+        REQUIRE(motion.angular_velocity == Approx(3.14159265f / 2.f));
+        REQUIRE(motion.acceleration == Approx(-20.f));
+    }
+    REQUIRE(count == 1);
+}
+
+TEST_CASE("Pooled bullets take their spawn tick from SimTick", "[bullet_motion][bullet_pool]") {
+    entt::registry reg;
+    reg.ctx().emplace<SimTick>().tick = 7;
+    auto& pool = reg.ctx().emplace<systems::BulletPool>();
+
+    systems::BulletSpawnParams params;
+    params.origin_x = 100.f;
+    params.origin_y = 100.f;
+    params.speed = 120.f;
+    systems::spawn_bullet(reg, params);
+
+    REQUIRE(pool.motion[0].spawn_tick == 7);
+    systems::advance_bullet_pool(pool, 7);
+    REQUIRE(pool.x[0] == Approx(101.f));
+}
@@ -0,0 +1,176 @@
+#include "ecs/components.hpp"
+#include "ecs/systems/bullet_pool.hpp"
+#include "ecs/systems/bullet_spawn.hpp"
+#include "ecs/systems/collision_system.hpp"
+
+#include <entt/entt.hpp>
+
+#include <catch2/catch_approx.hpp>
+#include <catch2/catch_test_macros.hpp>
+
+#include <vector>
+
+using namespace raven;
+using systems::BulletPool;
+using systems::BulletSpawnParams;
+
+namespace {
+
+/// @brief Spawn params for a bullet at rest (or moving) at a position.
+BulletSpawnParams bullet_at(float x, float y, Bullet::Owner owner, float speed = 0.f) {
+    BulletSpawnParams params;
+    params.origin_x = x;
+    params.origin_y = y;
+    params.speed = speed;
+    params.owner = owner;
+    params.hitbox_radius = 3.f;
+    return params;
+}
+
+} // namespace
+
+TEST_CASE("spawn_bullet routes to the pool when present", "[bullet_pool]") {
+    entt::registry reg;
+
+    SECTION("Without a pool a registry entity is created") {
+        auto ent = systems::spawn_bullet(reg, bullet_at(10.f, 10.f, Bullet::Owner::Enemy));
+        REQUIRE(reg.valid(ent));
+        REQUIRE(reg.all_of<Transform2D, Bullet, DamageOnContact, OffScreenDespawn>(ent));
+    }
+
+    SECTION("With a pool no entity is created") {
+        auto& pool = reg.ctx().emplace<BulletPool>();
+        auto ent = systems::spawn_bullet(reg, bullet_at(10.f, 20.f, Bullet::Owner::Enemy, 120.f));
+        REQUIRE(ent == entt::null);
+        REQUIRE(reg.view<Bullet>().size() == 0);
+        REQUIRE(pool.size() == 1);
+        REQUIRE(pool.x[0] == Catch::Approx(10.f));
+        REQUIRE(pool.y[0] == Catch::Approx(20.f));
+        REQUIRE(pool.vx[0] == Catch::Approx(120.f));
+        REQUIRE(pool.vy[0] == Catch::Approx(0.f).margin(0.001));
+    }
+}
+
+TEST_CASE("BulletPool swap-remove keeps arrays consistent", "[bullet_pool]") {
+    BulletPool pool;
+    for (int i = 0; i < 4; ++i) {
+        auto params = bullet_at(static_cast<float>(i), 0.f, Bullet::Owner::Enemy);
+        params.piercing = (i == 3);
+        pool.spawn(params);
+    }
+
+    pool.remove(0);
+    REQUIRE(pool.size() == 3);
+    // Last bullet (x = 3, piercing) moved into slot 0
+    REQUIRE(pool.x[0] == Catch::Approx(3.f));
+    REQUIRE(pool.piercing_hits(0) != nullptr);
+    REQUIRE(pool.piercing_hits(1) == nullptr);
+
+    std::vector<std::size_t> slots{0, 2, 0};
+    pool.remove_all(slots);
+    REQUIRE(pool.size() == 1);
+    REQUIRE(pool.x[0] == Catch::Approx(1.f));
+    REQUIRE(pool.piercing.empty());
+}
+
+TEST_CASE("BulletPool advance and cleanup", "[bullet_pool]") {
+    BulletPool pool;
+    pool.spawn(bullet_at(100.f, 100.f, Bullet::Owner::Enemy, 120.f), 0);
+
+    // Spawned in tick 0; after tick 59 it has travelled 60 steps (0.5 s)
+    systems::advance_bullet_pool(pool, 59);
+    REQUIRE(pool.x[0] == Catch::Approx(160.f));
+    REQUIRE(pool.vx[0] == Catch::Approx(120.f));
+
+    SECTION("Expired bullets are removed") {
+        auto params = bullet_at(50.f, 50.f, Bullet::Owner::Enemy);
+        params.lifetime = 0.1f;
+        pool.spawn(params);
+        systems::cleanup_bullet_pool(pool, 0.2f, 480, 270);
+        REQUIRE(pool.size() == 1);
+        REQUIRE(pool.x[0] == Catch::Approx(160.f));
+    }
+
+    SECTION("Off-screen bullets are removed") {
+        pool.spawn(bullet_at(600.f, 50.f, Bullet::Owner::Enemy));
+        systems::cleanup_bullet_pool(pool, 0.f, 480, 270);
+        REQUIRE(pool.size() == 1);
+    }
+
+    SECTION("Off-screen is measured from the camera view") {
+        pool.spawn(bullet_at(600.f, 50.f, Bullet::Owner::Enemy));
+        systems::cleanup_bullet_pool(pool, 0.f, 480, 270, 300.f, 0.f);
+        REQUIRE(pool.size() == 2);
+        systems::cleanup_bullet_pool(pool, 0.f, 480, 270, 700.f, 0.f);
+        REQUIRE(pool.size() == 0);
+    }
+}
+
+TEST_CASE("Pooled bullets collide like entity bullets", "[bullet_pool][collision]") {
+    entt::registry reg;
+    auto& pool = reg.ctx().emplace<BulletPool>();
+
+    SECTION("Enemy bullet hits player once and is consumed") {
+        auto player = reg.create();
+        reg.emplace<Transform2D>(player, 100.f, 100.f);
+        reg.emplace<CircleHitbox>(player, 2.f, 0.f, 0.f);
+        reg.emplace<Player>(player);
+        reg.emplace<Health>(player, 3.f, 3.f);
+
+        systems::spawn_bullet(reg, bullet_at(101.f, 100.f, Bullet::Owner::Enemy));
+        systems::spawn_bullet(reg, bullet_at(100.f, 101.f, Bullet::Owner::Enemy));
+        systems::spawn_bullet(reg, bullet_at(300.f, 100.f, Bullet::Owner::Enemy));
+
+        systems::update_collision(reg);
+
+        REQUIRE(reg.get<Health>(player).current == Catch::Approx(2.f));
+        REQUIRE(reg.all_of<Invulnerable>(player));
+        REQUIRE(pool.size() == 2);
+    }
+
+    SECTION("Piercing player bullet damages each enemy once") {
+        auto enemy = reg.create();
+        reg.emplace<Transform2D>(enemy, 100.f, 100.f);
+        reg.emplace<CircleHitbox>(enemy, 6.f, 0.f, 0.f);
+        reg.emplace<Enemy>(enemy);
+        reg.emplace<Health>(enemy, 3.f, 3.f);
+
+        auto params = bullet_at(103.f, 100.f, Bullet::Owner::Player, 200.f);
+        params.piercing = true;
+        systems::spawn_bullet(reg, params);
+        systems::spawn_bullet(reg, bullet_at(97.f, 100.f, Bullet::Owner::Player));
+
+        systems::update_collision(reg);
+        systems::update_collision(reg);
+
+        // One piercing hit + one regular hit; the regular bullet is consumed
+        REQUIRE(reg.get<Health>(enemy).current == Catch::Approx(1.f));
+        REQUIRE(pool.size() == 1);
+        REQUIRE(pool.piercing_hits(0) != nullptr);
+        REQUIRE(reg.get<Knockback>(enemy).dx == Catch::Approx(150.f));
+    }
+
+    SECTION("Detection finds pooled hits through the grid; resolution consumes them") {
+        auto player = reg.create();
+        reg.emplace<Transform2D>(player, 100.f, 100.f);
+        reg.emplace<CircleHitbox>(player, 2.f, 0.f, 0.f);
+        reg.emplace<Player>(player);
+        reg.emplace<Health>(player, 3.f, 3.f);
+
+        for (int i = 0; i < 200; ++i) {
+            systems::spawn_bullet(reg, bullet_at(static_cast<float>(200 + i), 200.f,
+                                                 Bullet::Owner::Enemy));
+        }
+        systems::spawn_bullet(reg, bullet_at(101.f, 100.f, Bullet::Owner::Enemy));
+
+        ContactBuffer contacts;
+        systems::detect_collisions(reg, contacts);
+        REQUIRE(contacts.contacts.size() == 1);
+        REQUIRE(contacts.contacts[0].source == entt::null);
+        REQUIRE(pool.size() == 201);
+
+        systems::resolve_contacts(reg, contacts);
+        REQUIRE(pool.size() == 200);
+        REQUIRE(reg.get<Health>(player).current == Catch::Approx(2.f));
+    }
+}
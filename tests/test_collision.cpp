@@ -1,12 +1,20 @@
 #include "ecs/components.hpp"
 #include "ecs/systems/collision_system.hpp"
 #include "ecs/systems/hitbox_math.hpp"
+#include "ecs/systems/spatial_grid.hpp"
 
 #include <entt/entt.hpp>
 
 #include <catch2/catch_approx.hpp>
 #include <catch2/catch_test_macros.hpp>
 
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <random>
+#include <unordered_map>
+#include <vector>
+
 using namespace raven;
 using systems::circles_overlap;
 
@@ -274,3 +282,137 @@ TEST_CASE("Player bullet vs enemy collision", "[collision]") {
         REQUIRE(hp2.current == Catch::Approx(2.f));
     }
 }
+
+TEST_CASE("SpatialGrid broad-phase queries", "[collision]") {
+    systems::SpatialGrid grid;
+    grid.reset(480.f, 270.f, 32.f);
+    REQUIRE(grid.cols() == 15);
+    REQUIRE(grid.rows() == 9);
+
+    SECTION("Large hitbox is found from every cell it overlaps") {
+        // Boss-sized circle straddling the corner of four cells
+        grid.insert(7, 64.f, 64.f, 18.f);
+        REQUIRE(grid.cell(1, 1).size() == 1);
+        REQUIRE(grid.cell(2, 2).size() == 1);
+
+        std::vector<uint32_t> out;
+        grid.query(40.f, 40.f, 2.f, out);
+        REQUIRE(out == std::vector<uint32_t>{7});
+        grid.query(90.f, 90.f, 2.f, out);
+        REQUIRE(out == std::vector<uint32_t>{7});
+    }
+
+    SECTION("Query results are sorted and unique") {
+        grid.insert(3, 100.f, 100.f, 20.f);
+        grid.insert(1, 110.f, 100.f, 20.f);
+        std::vector<uint32_t> out;
+        grid.query(100.f, 100.f, 40.f, out);
+        REQUIRE(out == std::vector<uint32_t>{1, 3});
+    }
+
+    SECTION("Out-of-bounds positions clamp to edge cells") {
+        grid.insert(0, -50.f, 500.f, 3.f);
+        std::vector<uint32_t> out;
+        grid.query(-60.f, 490.f, 3.f, out);
+        REQUIRE(out == std::vector<uint32_t>{0});
+    }
+}
+
+TEST_CASE("Grid collision matches brute-force pair testing", "[collision]") {
+    entt::registry reg;
+    std::mt19937 rng(1234);
+    std::uniform_real_distribution<float> x_dist(-20.f, 500.f);
+    std::uniform_real_distribution<float> y_dist(-20.f, 290.f);
+    std::uniform_real_distribution<float> r_dist(2.f, 18.f);
+
+    for (int i = 0; i < 150; ++i) {
+        auto e = reg.create();
+        reg.emplace<Transform2D>(e, x_dist(rng), y_dist(rng));
+        reg.emplace<CircleHitbox>(e, r_dist(rng), 0.f, 0.f);
+        reg.emplace<Enemy>(e);
+        reg.emplace<Health>(e, 100.f, 100.f);
+    }
+    for (int i = 0; i < 400; ++i) {
+        auto b = reg.create();
+        reg.emplace<Transform2D>(b, x_dist(rng), y_dist(rng));
+        reg.emplace<CircleHitbox>(b, 3.f, 1.f, -1.f);
+        reg.emplace<Bullet>(b, Bullet::Owner::Player);
+        reg.emplace<DamageOnContact>(b, 1.f);
+    }
+
+    // Reference: first overlapping enemy in view order takes the hit
+    std::unordered_map<entt::entity, float> expected_hp;
+    std::vector<entt::entity> expected_destroyed;
+    auto enemies = reg.view<Transform2D, CircleHitbox, Enemy, Health>();
+    for (auto [e, tf, hb, enemy, hp] : enemies.each()) {
+        expected_hp[e] = hp.current;
+    }
+    auto bullets = reg.view<Transform2D, CircleHitbox, Bullet, DamageOnContact>();
+    for (auto [b, b_tf, b_hb, bullet, dmg] : bullets.each()) {
+        for (auto [e, e_tf, e_hb, enemy, hp] : enemies.each()) {
+            if (circles_overlap(b_tf.x + b_hb.offset_x, b_tf.y + b_hb.offset_y, b_hb.radius,
+                                e_tf.x + e_hb.offset_x, e_tf.y + e_hb.offset_y, e_hb.radius)) {
+                expected_hp[e] -= dmg.damage;
+                expected_destroyed.push_back(b);
+                break;
+            }
+        }
+    }
+    REQUIRE_FALSE(expected_destroyed.empty());
+
+    systems::update_collision(reg);
+
+    for (auto [e, tf, hb, enemy, hp] : enemies.each()) {
+        REQUIRE(hp.current == expected_hp[e]);
+    }
+    for (auto b : expected_destroyed) {
+        REQUIRE_FALSE(reg.valid(b));
+    }
+    REQUIRE(reg.view<Bullet>().size() == 400 - expected_destroyed.size());
+}
+
+TEST_CASE("Collision emits a contact stream and batches hit sounds", "[collision]") {
+    entt::registry reg;
+    reg.ctx().emplace<AudioQueue>();
+
+    auto bullet = reg.create();
+    reg.emplace<Transform2D>(bullet, 100.f, 100.f);
+    reg.emplace<Velocity>(bullet, 0.f, 200.f);
+    reg.emplace<CircleHitbox>(bullet, 3.f, 0.f, 0.f);
+    reg.emplace<Bullet>(bullet, Bullet::Owner::Player);
+    reg.emplace<DamageOnContact>(bullet, 1.f);
+    reg.emplace<Piercing>(bullet);
+
+    // A piercing shot crossing a column of enemies in a single tick
+    std::vector<entt::entity> enemies;
+    for (int i = 0; i < 5; ++i) {
+        auto e = reg.create();
+        reg.emplace<Transform2D>(e, 100.f, 100.f + static_cast<float>(i));
+        reg.emplace<CircleHitbox>(e, 6.f, 0.f, 0.f);
+        reg.emplace<Enemy>(e);
+        reg.emplace<Health>(e, 3.f, 3.f);
+        enemies.push_back(e);
+    }
+
+    systems::update_collision(reg);
+
+    const auto& contacts = reg.ctx().get<ContactBuffer>().contacts;
+    REQUIRE(contacts.size() == 5);
+    for (const auto& c : contacts) {
+        REQUIRE(c.source == bullet);
+        REQUIRE(c.kind == Contact::Kind::EnemyHit);
+        REQUIRE(c.nx == Catch::Approx(0.f));
+        REQUIRE(c.ny == Catch::Approx(1.f));
+    }
+
+    for (auto e : enemies) {
+        REQUIRE(reg.get<Health>(e).current == Catch::Approx(2.f));
+        REQUIRE(reg.get<Knockback>(e).dy == Catch::Approx(150.f));
+    }
+    REQUIRE(reg.get<Piercing>(bullet).hit.size() == 5);
+
+    // Five hits, one sound
+    const auto& events = reg.ctx().get<AudioQueue>().events;
+    REQUIRE(events.size() == 1);
+    REQUIRE(events[0] == Sfx::EnemyHit);
+}
@@ -0,0 +1,67 @@
+#include "ecs/components.hpp"
+#include "ecs/systems/debug_draw_system.hpp"
+#include "rendering/debug_draw.hpp"
+#include "rendering/tilemap.hpp"
+
+#include <entt/entt.hpp>
+
+#include <catch2/catch_test_macros.hpp>
+
+using namespace raven;
+
+TEST_CASE("DebugDraw records shapes as line segments", "[debug_draw]") {
+    DebugDraw draw;
+    REQUIRE(draw.empty());
+
+    draw.line(0.f, 0.f, 10.f, 0.f, {255, 255, 255, 255});
+    REQUIRE(draw.segments() == 1);
+
+    draw.rect({0.f, 0.f, 8.f, 8.f}, {255, 255, 255, 255});
+    REQUIRE(draw.segments() == 5);
+
+    draw.circle(0.f, 0.f, 6.f, {255, 255, 255, 255});
+    REQUIRE(draw.segments() == 5 + DebugDraw::CIRCLE_SEGMENTS);
+    draw.circle(0.f, 0.f, 2.f, {255, 255, 255, 255}, 1); // clamped to a triangle
+    REQUIRE(draw.segments() == 8 + DebugDraw::CIRCLE_SEGMENTS);
+
+    // Two edges plus the arc
+    draw.cone(0.f, 0.f, 1.f, 0.f, 30.f, 0.785f, {255, 255, 255, 255});
+    REQUIRE(draw.segments() == 10 + DebugDraw::CIRCLE_SEGMENTS + DebugDraw::CONE_SEGMENTS);
+
+    draw.clear();
+    REQUIRE(draw.empty());
+}
+
+TEST_CASE("extract_debug_draw follows the ctx flags", "[debug_draw]") {
+    entt::registry reg;
+    Tilemap tilemap;
+
+    auto player = reg.create();
+    reg.emplace<Transform2D>(player, 100.f, 100.f);
+    reg.emplace<Player>(player);
+    reg.emplace<CircleHitbox>(player, 6.f);
+
+    auto enemy = reg.create();
+    reg.emplace<Transform2D>(enemy, 150.f, 100.f);
+    reg.emplace<Enemy>(enemy);
+    reg.emplace<CircleHitbox>(enemy, 7.f);
+    reg.emplace<AiBehavior>(enemy);
+
+    DebugDraw draw;
+    systems::extract_debug_draw(reg, tilemap, draw);
+    REQUIRE(draw.empty());
+
+    auto& flags = reg.ctx().emplace<DebugDrawFlags>();
+    systems::extract_debug_draw(reg, tilemap, draw);
+    REQUIRE(draw.empty());
+
+    flags.hitboxes = true;
+    systems::extract_debug_draw(reg, tilemap, draw);
+    REQUIRE(draw.segments() == 2 * DebugDraw::CIRCLE_SEGMENTS);
+
+    // One ray per AI enemy; the previous shapes are replaced, not appended
+    flags.hitboxes = false;
+    flags.sight = true;
+    systems::extract_debug_draw(reg, tilemap, draw);
+    REQUIRE(draw.segments() == 1);
+}
@@ -1,6 +1,8 @@
 #include "core/string_id.hpp"
+#include "ecs/command_buffer.hpp"
 #include "ecs/components.hpp"
 #include "ecs/systems/animation_system.hpp"
+#include "ecs/systems/camera_system.hpp"
 
 #include <entt/entt.hpp>
 
@@ -149,3 +151,105 @@ TEST_CASE("Animation system", "[ecs][animation]") {
         REQUIRE(sprite.frame_y == 5);
     }
 }
+
+TEST_CASE("CommandBuffer defers structural changes", "[ecs][commands]") {
+    entt::registry reg;
+    auto a = reg.create();
+    auto b = reg.create();
+    reg.emplace<Transform2D>(a, 1.f, 2.f);
+    reg.emplace<Velocity>(b, 3.f, 4.f);
+
+    CommandBuffer cmds;
+
+    SECTION("Destroys are deduplicated and applied at flush") {
+        cmds.destroy(a);
+        cmds.destroy(a);
+        cmds.destroy(b);
+        REQUIRE(cmds.pending_destroys() == 3);
+        REQUIRE(reg.valid(a));
+
+        cmds.flush(reg);
+        REQUIRE_FALSE(reg.valid(a));
+        REQUIRE_FALSE(reg.valid(b));
+        REQUIRE(cmds.empty());
+    }
+
+    SECTION("Emplace and remove apply before destroys") {
+        cmds.emplace<Knockback>(a, 10.f, 0.f, 0.1f);
+        cmds.remove<Velocity>(b);
+        cmds.emplace<Knockback>(b, 1.f, 1.f, 0.1f);
+        cmds.destroy(b);
+        REQUIRE_FALSE(reg.all_of<Knockback>(a));
+
+        cmds.flush(reg);
+        REQUIRE(reg.get<Knockback>(a).dx == Catch::Approx(10.f));
+        REQUIRE_FALSE(reg.valid(b));
+    }
+
+    SECTION("Stale handles are skipped") {
+        cmds.destroy(a);
+        cmds.emplace<Knockback>(a, 1.f, 0.f, 0.1f);
+        reg.destroy(a);
+        auto recycled = reg.create(); // may reuse a's index with a new version
+        cmds.flush(reg);
+        REQUIRE(reg.valid(recycled));
+        REQUIRE_FALSE(reg.all_of<Knockback>(recycled));
+    }
+
+    SECTION("DeferredCommands prefers the registry ctx buffer") {
+        auto& shared = reg.ctx().emplace<CommandBuffer>();
+        {
+            DeferredCommands deferred(reg);
+            deferred->destroy(a);
+        }
+        REQUIRE(reg.valid(a));
+        shared.flush(reg);
+        REQUIRE_FALSE(reg.valid(a));
+    }
+
+    SECTION("DeferredCommands flushes a local buffer without one") {
+        {
+            DeferredCommands deferred(reg);
+            deferred->destroy(a);
+            REQUIRE(reg.valid(a));
+        }
+        REQUIRE_FALSE(reg.valid(a));
+    }
+}
+
+TEST_CASE("Camera follows the player inside the level", "[ecs][camera]") {
+    entt::registry reg;
+    auto player = reg.create();
+    reg.emplace<Transform2D>(player, 100.f, 100.f);
+    reg.emplace<Player>(player);
+
+    // 1000x600 level, 480x270 view
+    systems::configure_camera(reg, 1000.f, 600.f);
+    auto& camera = reg.ctx().get<Camera>();
+    REQUIRE(camera.x == Catch::Approx(0.f)); // clamped at the top-left
+    REQUIRE(camera.y == Catch::Approx(0.f));
+    REQUIRE(camera.prev_x == camera.x);
+
+    SECTION("View centres on the player and keeps the previous position") {
+        reg.get<Transform2D>(player) = {500.f, 300.f};
+        systems::update_camera(reg);
+        REQUIRE(camera.x == Catch::Approx(260.f));
+        REQUIRE(camera.y == Catch::Approx(165.f));
+        REQUIRE(camera.prev_x == Catch::Approx(0.f));
+    }
+
+    SECTION("View stops at the far edges") {
+        reg.get<Transform2D>(player) = {990.f, 590.f};
+        systems::update_camera(reg);
+        REQUIRE(camera.x == Catch::Approx(520.f));
+        REQUIRE(camera.y == Catch::Approx(330.f));
+    }
+
+    SECTION("Levels smaller than the view do not scroll") {
+        systems::configure_camera(reg, 320.f, 200.f);
+        reg.get<Transform2D>(player) = {300.f, 190.f};
+        systems::update_camera(reg);
+        REQUIRE(reg.ctx().get<Camera>().x == Catch::Approx(0.f));
+        REQUIRE(reg.ctx().get<Camera>().y == Catch::Approx(0.f));
+    }
+}
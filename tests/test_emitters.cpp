@@ -1,5 +1,6 @@
 #include "core/string_id.hpp"
 #include "ecs/components.hpp"
+#include "ecs/systems/bullet_spawn.hpp"
 #include "ecs/systems/emitter_system.hpp"
 #include "patterns/pattern_library.hpp"
 
@@ -8,6 +9,7 @@
 #include <catch2/catch_approx.hpp>
 #include <catch2/catch_test_macros.hpp>
 #include <cmath>
+#include <vector>
 
 using namespace raven;
 
@@ -179,3 +181,44 @@ TEST_CASE("Emitter system", "[emitters]") {
         }
     }
 }
+
+TEST_CASE("spawn_bullets matches per-bullet spawning", "[emitters]") {
+    std::vector<systems::BulletSpawnParams> burst;
+    for (int i = 0; i < 16; ++i) {
+        systems::BulletSpawnParams params;
+        params.origin_x = 50.f;
+        params.origin_y = 60.f;
+        params.angle_rad = static_cast<float>(i) * 0.4f;
+        params.speed = 90.f;
+        params.damage = 2.f;
+        params.owner = Bullet::Owner::Enemy;
+        params.piercing = (i % 4 == 0);
+        burst.push_back(params);
+    }
+
+    entt::registry single;
+    std::vector<entt::entity> expected;
+    for (const auto& params : burst) {
+        expected.push_back(systems::spawn_bullet(single, params));
+    }
+
+    entt::registry batched;
+    systems::spawn_bullets(batched, burst);
+
+    REQUIRE(count_bullets(batched) == 16);
+    REQUIRE(batched.view<Piercing>().size() == 4);
+
+    // Same entity ids, same component values
+    for (auto ent : expected) {
+        REQUIRE(batched.valid(ent));
+        const auto& a = single.get<Velocity>(ent);
+        const auto& b = batched.get<Velocity>(ent);
+        REQUIRE(a.dx == b.dx);
+        REQUIRE(a.dy == b.dy);
+        REQUIRE(batched.get<Transform2D>(ent).rotation == single.get<Transform2D>(ent).rotation);
+        REQUIRE(batched.get<Sprite>(ent).layer == 5);
+        REQUIRE(batched.all_of<PreviousTransform, DamageOnContact, Lifetime, CircleHitbox,
+                               OffScreenDespawn>(ent));
+        REQUIRE(batched.all_of<Piercing>(ent) == single.all_of<Piercing>(ent));
+    }
+}
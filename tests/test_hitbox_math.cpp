@@ -0,0 +1,117 @@
+#include "ecs/systems/hitbox_math.hpp"
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <random>
+#include <vector>
+
+// tests/CMakeLists.txt builds this file again with AVX2 enabled and with
+// RAVEN_NO_SIMD, so every kernel path is checked against the scalar tests.
+#if defined(RAVEN_EXPECT_AVX2) && !defined(RAVEN_HITBOX_AVX2)
+#error "AVX2 test build did not select the AVX2 kernels"
+#endif
+#if defined(RAVEN_NO_SIMD) && defined(RAVEN_HITBOX_SSE2)
+#error "RAVEN_NO_SIMD test build still selected SIMD kernels"
+#endif
+
+using namespace raven;
+using systems::circles_overlap;
+
+TEST_CASE("Batched overlap kernels agree with scalar tests", "[collision][simd]") {
+#if defined(RAVEN_HITBOX_AVX2) && (defined(__GNUC__) || defined(__clang__))
+    if (!__builtin_cpu_supports("avx2")) {
+        SKIP("CPU lacks AVX2");
+    }
+#endif
+
+    std::mt19937 rng(99);
+    std::uniform_real_distribution<float> pos(-100.f, 100.f);
+    std::uniform_real_distribution<float> rad(0.f, 20.f);
+    std::uniform_real_distribution<float> angle(-3.2f, 3.2f);
+
+    for (int iter = 0; iter < 500; ++iter) {
+        // Odd counts exercise the 8-, 4- and 1-wide tails
+        std::size_t count = 1 + static_cast<std::size_t>(iter) % systems::HITBOX_BATCH_WIDTH;
+        systems::CircleSoA soa;
+        for (std::size_t i = 0; i < count; ++i) {
+            soa.push(pos(rng), pos(rng), rad(rng));
+        }
+        // Exactly coincident target (cone "at origin" branch)
+        soa.x[0] = 1.f;
+        soa.y[0] = 2.f;
+
+        float qx = iter % 3 == 0 ? 1.f : pos(rng) * 0.1f;
+        float qy = iter % 3 == 0 ? 2.f : pos(rng) * 0.1f;
+        float qr = rad(rng) * 3.f;
+
+        uint64_t circles =
+            systems::circles_overlap_batch(qx, qy, qr, soa.x.data(), soa.y.data(), soa.r.data(),
+                                           count);
+
+        float a = angle(rng);
+        float aim_x = iter % 10 == 0 ? 0.f : std::cos(a);
+        float aim_y = iter % 10 == 0 ? 0.f : std::sin(a);
+        float range = rad(rng) * 4.f;
+        float half_angle = rad(rng) * 0.1f;
+        auto cone = systems::make_cone(qx, qy, aim_x, aim_y, range, half_angle);
+        uint64_t cones =
+            systems::points_in_cone_batch(cone, soa.x.data(), soa.y.data(), soa.r.data(), count);
+
+        for (std::size_t i = 0; i < count; ++i) {
+            bool circle_hit = circles_overlap(qx, qy, qr, soa.x[i], soa.y[i], soa.r[i]);
+            REQUIRE(((circles >> i) & 1u) == (circle_hit ? 1u : 0u));
+
+            bool cone_hit = systems::point_in_cone(qx, qy, aim_x, aim_y, soa.x[i], soa.y[i],
+                                                   range + soa.r[i], half_angle);
+            REQUIRE(((cones >> i) & 1u) == (cone_hit ? 1u : 0u));
+        }
+        // No bits beyond the requested lanes
+        if (count < systems::HITBOX_BATCH_WIDTH) {
+            REQUIRE((circles >> count) == 0);
+            REQUIRE((cones >> count) == 0);
+        }
+    }
+}
+
+TEST_CASE("for_each_hit visits every hit across batches in order", "[collision][simd]") {
+#if defined(RAVEN_HITBOX_AVX2) && (defined(__GNUC__) || defined(__clang__))
+    if (!__builtin_cpu_supports("avx2")) {
+        SKIP("CPU lacks AVX2");
+    }
+#endif
+
+    std::mt19937 rng(7);
+    std::uniform_real_distribution<float> pos(-100.f, 100.f);
+    std::uniform_real_distribution<float> rad(0.f, 20.f);
+
+    // Two full batches plus a tail
+    systems::CircleSoA soa;
+    for (std::size_t i = 0; i < 2 * systems::HITBOX_BATCH_WIDTH + 13; ++i) {
+        soa.push(pos(rng), pos(rng), rad(rng));
+    }
+
+    std::vector<std::size_t> circle_hits;
+    systems::for_each_hit(soa, 5.f, -3.f, 40.f, [&](std::size_t i) { circle_hits.push_back(i); });
+    std::vector<std::size_t> expected;
+    for (std::size_t i = 0; i < soa.size(); ++i) {
+        if (circles_overlap(5.f, -3.f, 40.f, soa.x[i], soa.y[i], soa.r[i])) {
+            expected.push_back(i);
+        }
+    }
+    REQUIRE(circle_hits == expected);
+
+    auto cone = systems::make_cone(5.f, -3.f, 1.f, 1.f, 60.f, 0.6f);
+    std::vector<std::size_t> cone_hits;
+    systems::for_each_hit(soa, cone, [&](std::size_t i) { cone_hits.push_back(i); });
+    expected.clear();
+    for (std::size_t i = 0; i < soa.size(); ++i) {
+        if (systems::point_in_cone(5.f, -3.f, 1.f, 1.f, soa.x[i], soa.y[i], 60.f + soa.r[i],
+                                   0.6f)) {
+            expected.push_back(i);
+        }
+    }
+    REQUIRE(cone_hits == expected);
+}
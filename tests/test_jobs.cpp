@@ -0,0 +1,118 @@
+#include "core/jobs.hpp"
+#include "ecs/components.hpp"
+#include "ecs/system_scheduler.hpp"
+
+#include <entt/entt.hpp>
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <atomic>
+#include <cstddef>
+#include <stdexcept>
+#include <vector>
+
+using namespace raven;
+
+TEST_CASE("parallel_for visits every index exactly once", "[jobs]") {
+    JobSystem jobs(3);
+    std::vector<std::atomic<int>> hits(10'007);
+
+    jobs.parallel_for(hits.size(), 64, [&](std::size_t begin, std::size_t end) {
+        for (std::size_t i = begin; i < end; ++i) {
+            hits[i].fetch_add(1);
+        }
+    });
+
+    for (const auto& hit : hits) {
+        REQUIRE(hit.load() == 1);
+    }
+}
+
+TEST_CASE("Nested parallel_for completes without deadlocking", "[jobs]") {
+    JobSystem jobs(2);
+    std::atomic<std::size_t> total{0};
+
+    jobs.parallel_for(16, 1, [&](std::size_t outer_begin, std::size_t outer_end) {
+        for (std::size_t o = outer_begin; o < outer_end; ++o) {
+            jobs.parallel_for(100, 10, [&](std::size_t begin, std::size_t end) {
+                total.fetch_add(end - begin);
+            });
+        }
+    });
+
+    REQUIRE(total.load() == 1600);
+}
+
+TEST_CASE("parallel_for rethrows a chunk's exception after draining", "[jobs]") {
+    JobSystem jobs(3);
+    std::atomic<std::size_t> ran{0};
+
+    REQUIRE_THROWS_AS(jobs.parallel_for(64, 1,
+                                        [&](std::size_t begin, std::size_t) {
+                                            ran.fetch_add(1);
+                                            if (begin == 37) {
+                                                throw std::runtime_error("chunk failed");
+                                            }
+                                        }),
+                      std::runtime_error);
+    REQUIRE(ran.load() == 64);
+
+    // The pool stays usable afterwards
+    std::atomic<std::size_t> after{0};
+    jobs.parallel_for(8, 1, [&](std::size_t, std::size_t) { after.fetch_add(1); });
+    REQUIRE(after.load() == 8);
+}
+
+TEST_CASE("parallel_each over a view matches a serial each()", "[jobs]") {
+    entt::registry reg;
+    for (int i = 0; i < 1000; ++i) {
+        auto e = reg.create();
+        reg.emplace<Transform2D>(e, static_cast<float>(i), 0.f);
+        reg.emplace<Velocity>(e, 1.f, static_cast<float>(i % 7));
+        if (i % 3 == 0) {
+            reg.emplace<BulletMotion>(e);
+        }
+    }
+    // Leave holes in the packed arrays
+    for (int i = 0; i < 1000; i += 11) {
+        reg.remove<Velocity>(static_cast<entt::entity>(i));
+    }
+
+    JobSystem jobs(3);
+    auto view = reg.view<Transform2D, Velocity>(entt::exclude<BulletMotion>);
+    parallel_each(&jobs, view, 16, [](entt::entity, Transform2D& tf, const Velocity& vel) {
+        tf.x += vel.dx;
+        tf.y += vel.dy;
+    });
+
+    for (auto [entity, tf] : reg.view<Transform2D>().each()) {
+        auto i = static_cast<int>(entity);
+        bool moved = i % 3 != 0 && i % 11 != 0;
+        REQUIRE(tf.x == static_cast<float>(i) + (moved ? 1.f : 0.f));
+        REQUIRE(tf.y == (moved ? static_cast<float>(i % 7) : 0.f));
+    }
+
+    // Storages work too, and a null job system runs inline
+    std::size_t visited = 0;
+    parallel_each(nullptr, reg.storage<BulletMotion>(), 16,
+                  [&](entt::entity, BulletMotion&) { ++visited; });
+    REQUIRE(visited == reg.storage<BulletMotion>().size());
+}
+
+TEST_CASE("SystemScheduler skips dependents of a throwing system", "[jobs][scheduler]") {
+    struct A {};
+    JobSystem jobs(2);
+    SystemScheduler scheduler(&jobs);
+    std::atomic<bool> dependent_ran{false};
+    std::atomic<bool> independent_ran{false};
+
+    scheduler.add("throws", SystemAccess{}.writes<A>(),
+                  [] { throw std::runtime_error("system failed"); });
+    scheduler.add("dependent", SystemAccess{}.reads<A>(), [&] { dependent_ran = true; });
+    scheduler.add("independent", SystemAccess{}.writes<Velocity>(),
+                  [&] { independent_ran = true; });
+
+    REQUIRE_THROWS_AS(scheduler.run(), std::runtime_error);
+    REQUIRE_FALSE(dependent_ran.load());
+    REQUIRE(independent_ran.load());
+}
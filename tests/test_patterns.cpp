@@ -1,9 +1,11 @@
 #include "core/string_id.hpp"
+#include "patterns/burst_table.hpp"
 #include "patterns/pattern_library.hpp"
 
 #include <catch2/catch_approx.hpp>
 #include <catch2/catch_test_macros.hpp>
 #include <cmath>
+#include <cstddef>
 
 using namespace raven;
 
@@ -175,3 +177,100 @@ TEST_CASE("PatternLibrary load_from_json", "[patterns]") {
         REQUIRE(has_beta);
     }
 }
+
+TEST_CASE("PatternLibrary dense ids", "[patterns]") {
+    StringInterner interner;
+    PatternLibrary lib;
+    lib.set_interner(interner);
+
+    nlohmann::json j1 = {{"name", "alpha"}, {"emitters", {{{"type", "radial"}}}}};
+    nlohmann::json j2 = {{"name", "beta"}, {"emitters", {{{"type", "aimed"}}}}};
+    REQUIRE(lib.load_from_json(j1));
+    REQUIRE(lib.load_from_json(j2));
+
+    SECTION("Ids follow load order and index names_view()") {
+        auto alpha = lib.id("alpha");
+        auto beta = lib.id("beta");
+        REQUIRE(alpha.value == 0);
+        REQUIRE(beta.value == 1);
+        REQUIRE_FALSE(lib.id("missing").valid());
+        REQUIRE(lib.get(PatternId{}) == nullptr);
+
+        auto names = lib.names_view();
+        REQUIRE(names.size() == 2);
+        REQUIRE(names[beta.value] == "beta");
+        REQUIRE(lib.get(beta)->name == "beta");
+    }
+
+    SECTION("Reloading a name keeps its id") {
+        nlohmann::json j3 = {{"name", "alpha"}, {"emitters", {{{"type", "linear"}}}}};
+        REQUIRE(lib.load_from_json(j3));
+        REQUIRE(lib.size() == 2);
+        REQUIRE(lib.id("alpha").value == 0);
+        REQUIRE(lib.get(lib.id("alpha"))->emitters[0].type == EmitterDef::Type::Linear);
+    }
+
+    SECTION("resolve() caches the id on the emitter") {
+        BulletEmitter emitter;
+        emitter.pattern_name = interner.intern("beta");
+        REQUIRE_FALSE(emitter.pattern_id.valid());
+
+        const auto* pattern = lib.resolve(emitter, interner);
+        REQUIRE(pattern != nullptr);
+        REQUIRE(pattern->name == "beta");
+        REQUIRE(emitter.pattern_id == lib.id("beta"));
+    }
+
+    SECTION("resolve() caches a missing pattern too") {
+        BulletEmitter emitter;
+        emitter.pattern_name = interner.intern("gamma");
+
+        REQUIRE(lib.resolve(emitter, interner) == nullptr);
+        REQUIRE(emitter.pattern_id.resolved());
+        REQUIRE_FALSE(emitter.pattern_id.valid());
+        REQUIRE(emitter.pattern_id.value == PatternId::MISSING);
+        REQUIRE(lib.resolve(emitter, interner) == nullptr);
+    }
+}
+
+TEST_CASE("BurstTable matches per-bullet trig", "[patterns]") {
+    constexpr int COUNT = 7;
+    constexpr float SPREAD_DEG = 90.f;
+    BurstTable table;
+    table.build(COUNT, SPREAD_DEG);
+    REQUIRE(table.size() == static_cast<std::size_t>(COUNT));
+
+    float center = 0.7f;
+    float spread_rad = SPREAD_DEG * PI / 180.f;
+    float step = spread_rad / static_cast<float>(COUNT);
+    float start = center - spread_rad / 2.f;
+
+    for (std::size_t i = 0; i < table.size(); ++i) {
+        float angle = start + step * static_cast<float>(i) + step / 2.f;
+        float dx = 0.f;
+        float dy = 0.f;
+        table.rotate(i, std::cos(center), std::sin(center), dx, dy);
+        REQUIRE(dx == Catch::Approx(std::cos(angle)).margin(1e-5));
+        REQUIRE(dy == Catch::Approx(std::sin(angle)).margin(1e-5));
+        REQUIRE(center + table.angle_off[i] == Catch::Approx(angle).margin(1e-5));
+    }
+
+    SECTION("Single-bullet tables point at the center") {
+        table.build(1, SPREAD_DEG);
+        REQUIRE(table.size() == 1);
+        REQUIRE(table.cos_off[0] == Catch::Approx(1.f));
+        REQUIRE(table.sin_off[0] == Catch::Approx(0.f));
+    }
+
+    SECTION("Parsed emitters carry a prebuilt table") {
+        StringInterner interner;
+        PatternLibrary lib;
+        lib.set_interner(interner);
+        nlohmann::json j = {
+            {"name", "fan"},
+            {"emitters", {{{"type", "radial"}, {"count", 5}, {"spread_angle", 60.f}}}}};
+        REQUIRE(lib.load_from_json(j));
+        const auto& edef = lib.get("fan")->emitters[0];
+        REQUIRE(edef.burst.matches(5, 60.f));
+    }
+}
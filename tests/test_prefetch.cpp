@@ -0,0 +1,55 @@
+#include "core/prefetch.hpp"
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <atomic>
+#include <stdexcept>
+#include <string>
+#include <thread>
+
+using namespace raven;
+
+TEST_CASE("Prefetch hands back the value started for the same key", "[prefetch]") {
+    Prefetch<std::string> prefetch;
+    REQUIRE_FALSE(prefetch.take("Room_1").has_value());
+
+    auto main_thread = std::this_thread::get_id();
+    std::atomic<bool> off_thread{false};
+    prefetch.start("Room_1", [&] {
+        off_thread = std::this_thread::get_id() != main_thread;
+        return std::string("tiles of Room_1");
+    });
+    REQUIRE(prefetch.pending("Room_1"));
+    REQUIRE_FALSE(prefetch.pending("Room_2"));
+
+    auto value = prefetch.take("Room_1");
+    REQUIRE(value.has_value());
+    REQUIRE(*value == "tiles of Room_1");
+    REQUIRE(off_thread.load());
+
+    // Taken once only
+    REQUIRE_FALSE(prefetch.pending("Room_1"));
+    REQUIRE_FALSE(prefetch.take("Room_1").has_value());
+}
+
+TEST_CASE("Prefetch drops a load claimed under another key", "[prefetch]") {
+    Prefetch<int> prefetch;
+    prefetch.start("Room_1", [] { return 1; });
+    REQUIRE_FALSE(prefetch.take("Room_2").has_value());
+    REQUIRE_FALSE(prefetch.pending("Room_1"));
+
+    // Starting again replaces the previous load
+    prefetch.start("Room_1", [] { return 1; });
+    prefetch.start("Room_3", [] { return 3; });
+    REQUIRE_FALSE(prefetch.take("Room_1").has_value());
+    REQUIRE_FALSE(prefetch.pending("Room_3"));
+}
+
+TEST_CASE("Prefetch rethrows the loader's exception on take", "[prefetch]") {
+    Prefetch<int> prefetch;
+    prefetch.start("Broken", []() -> int { throw std::runtime_error("bad level"); });
+    REQUIRE_THROWS_AS(prefetch.take("Broken"), std::runtime_error);
+
+    prefetch.start("Fine", [] { return 7; });
+    REQUIRE(prefetch.take("Fine").value() == 7);
+}
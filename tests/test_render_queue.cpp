@@ -0,0 +1,111 @@
+#include "rendering/render_queue.hpp"
+
+#include <catch2/catch_test_macros.hpp>
+
+using namespace raven;
+
+namespace {
+
+// flush(nullptr) never dereferences textures, so any distinct addresses will do
+SDL_Texture* fake_texture(int n) {
+    static char storage[4];
+    return reinterpret_cast<SDL_Texture*>(&storage[n]);
+}
+
+const SDL_FRect SRC{0.f, 0.f, 8.f, 8.f};
+
+// Slot @p x of a row of 8 px quads; neighbouring slots touch but do not overlap
+SDL_FRect at(float x) {
+    return {x * 8.f, 0.f, 8.f, 8.f};
+}
+
+} // namespace
+
+TEST_CASE("RenderQueue batches quads by layer and texture", "[render_queue]") {
+    RenderQueue queue;
+
+    SECTION("One texture is one draw call") {
+        for (int i = 0; i < 50; ++i) {
+            queue.push(0, fake_texture(0), SRC, at(static_cast<float>(i)));
+        }
+        queue.flush(nullptr);
+        REQUIRE(queue.stats().draw_calls == 1);
+        REQUIRE(queue.stats().quads == 50);
+        REQUIRE(queue.size() == 0);
+    }
+
+    SECTION("Interleaved textures in a layer are grouped") {
+        for (int i = 0; i < 10; ++i) {
+            queue.push(0, fake_texture(i % 2), SRC, at(static_cast<float>(i)));
+        }
+        queue.flush(nullptr);
+        REQUIRE(queue.stats().draw_calls == 2);
+        REQUIRE(queue.stats().quads == 10);
+    }
+
+    SECTION("Layers split runs of the same texture") {
+        queue.push(1, fake_texture(0), SRC, at(0.f));
+        queue.push(RenderQueue::LAYER_HUD, fake_texture(0), SRC, at(1.f));
+        queue.push(RenderQueue::LAYER_TILES, fake_texture(0), SRC, at(2.f));
+        queue.push(1, fake_texture(0), SRC, at(3.f));
+        queue.flush(nullptr);
+        REQUIRE(queue.stats().draw_calls == 3);
+        REQUIRE(queue.stats().quads == 4);
+    }
+
+    SECTION("Out-of-order layers with mixed textures are regrouped") {
+        queue.push(2, fake_texture(0), SRC, at(0.f));
+        queue.push(1, fake_texture(1), SRC, at(1.f));
+        queue.push(2, fake_texture(1), SRC, at(2.f));
+        queue.push(1, fake_texture(0), SRC, at(3.f));
+        queue.push(2, fake_texture(0), SRC, at(4.f));
+        queue.push(1, fake_texture(1), SRC, at(5.f));
+        queue.flush(nullptr);
+        REQUIRE(queue.stats().draw_calls == 4);
+        REQUIRE(queue.stats().quads == 6);
+    }
+
+    SECTION("Overlapping quads keep their order across textures") {
+        // Two atlas pages in one sprite layer, drawn back to front
+        queue.push(0, fake_texture(0), SRC, {0.f, 0.f, 16.f, 16.f});
+        queue.push(0, fake_texture(1), SRC, {4.f, 4.f, 16.f, 16.f});
+        queue.push(0, fake_texture(0), SRC, {8.f, 8.f, 16.f, 16.f});
+        queue.push(0, fake_texture(1), SRC, {40.f, 0.f, 16.f, 16.f});
+        queue.flush(nullptr);
+        // The third quad overlaps the second, so it cannot join the first
+        // run; the fourth overlaps nothing and joins the second
+        REQUIRE(queue.stats().draw_calls == 3);
+        REQUIRE(queue.stats().quads == 4);
+    }
+
+    SECTION("Fills batch separately from textured quads") {
+        queue.push_fill(0, at(0.f), {255, 0, 0, 255});
+        queue.push(0, fake_texture(0), SRC, at(1.f));
+        queue.push_fill(0, at(2.f), {0, 255, 0, 255});
+        queue.flush(nullptr);
+        REQUIRE(queue.stats().draw_calls == 2);
+        REQUIRE(queue.stats().quads == 3);
+    }
+
+    SECTION("Outlines are four fills, degenerate ones fewer") {
+        queue.push_outline(0, {0.f, 0.f, 10.f, 10.f}, {255, 255, 255, 255});
+        REQUIRE(queue.size() == 4);
+        queue.push_outline(0, {0.f, 0.f, 10.f, 1.f}, {255, 255, 255, 255});
+        REQUIRE(queue.size() == 5);
+        queue.push_outline(0, {0.f, 0.f, 0.f, 10.f}, {255, 255, 255, 255});
+        REQUIRE(queue.size() == 5);
+        queue.flush(nullptr);
+        REQUIRE(queue.stats().draw_calls == 1);
+    }
+
+    SECTION("Stats accumulate across flushes until reset") {
+        queue.push(0, fake_texture(0), SRC, at(0.f));
+        queue.flush(nullptr);
+        queue.push(0, fake_texture(0), SRC, at(0.f));
+        queue.flush(nullptr);
+        REQUIRE(queue.stats().draw_calls == 2);
+        queue.reset_stats();
+        REQUIRE(queue.stats().draw_calls == 0);
+        REQUIRE(queue.stats().quads == 0);
+    }
+}
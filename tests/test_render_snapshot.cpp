@@ -0,0 +1,233 @@
+#include "core/string_id.hpp"
+#include "core/triple_buffer.hpp"
+#include "ecs/components.hpp"
+#include "ecs/systems/bullet_pool.hpp"
+#include "ecs/systems/bullet_spawn.hpp"
+#include "ecs/systems/hud_system.hpp"
+#include "ecs/systems/render_system.hpp"
+#include "rendering/hud_layer.hpp"
+#include "rendering/render_snapshot.hpp"
+
+#include <entt/entt.hpp>
+
+#include <catch2/catch_approx.hpp>
+#include <catch2/catch_test_macros.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <thread>
+#include <vector>
+
+using namespace raven;
+using Catch::Approx;
+
+TEST_CASE("TripleBuffer hands the reader the newest published value", "[render_snapshot]") {
+    TripleBuffer<int> buffer;
+    REQUIRE_FALSE(buffer.has_fresh());
+
+    buffer.write_buffer() = 1;
+    buffer.publish();
+    buffer.write_buffer() = 2;
+    buffer.publish();
+    REQUIRE(buffer.has_fresh());
+    REQUIRE(buffer.read_buffer() == 2);
+
+    // Nothing new: the reader keeps its value, and the writer never
+    // receives the slot the reader holds
+    REQUIRE_FALSE(buffer.has_fresh());
+    buffer.write_buffer() = 3;
+    REQUIRE(buffer.read_buffer() == 2);
+    buffer.publish();
+    REQUIRE(buffer.read_buffer() == 3);
+}
+
+TEST_CASE("TripleBuffer reads never observe a value being written", "[render_snapshot]") {
+    // Each value is written as a block of identical ints; a torn read
+    // would see two different values in one block
+    TripleBuffer<std::vector<int>> buffer;
+    std::atomic<bool> done{false};
+
+    std::thread writer([&] {
+        for (int n = 1; n <= 20'000; ++n) {
+            auto& block = buffer.write_buffer();
+            block.assign(64, n);
+            buffer.publish();
+        }
+        done = true;
+    });
+
+    int last = 0;
+    while (!done) {
+        const auto& block = buffer.read_buffer();
+        if (block.empty()) {
+            continue;
+        }
+        REQUIRE(std::all_of(block.begin(), block.end(), [&](int v) { return v == block[0]; }));
+        REQUIRE(block[0] >= last);
+        last = block[0];
+    }
+    writer.join();
+    REQUIRE(buffer.read_buffer().front() == 20'000);
+}
+
+TEST_CASE("extract_sprites records both interpolation endpoints", "[render_snapshot]") {
+    entt::registry reg;
+    auto& interner = reg.ctx().emplace<StringInterner>();
+    reg.ctx().emplace<SimTick>().tick = 10;
+    reg.ctx().emplace<systems::BulletPool>();
+
+    auto walker = reg.create();
+    reg.emplace<Transform2D>(walker, 20.f, 30.f);
+    reg.emplace<PreviousTransform>(walker, 10.f, 25.f);
+    reg.emplace<Sprite>(walker, interner.intern("player"), 0, 0, 16, 16, 10);
+    reg.emplace<Player>(walker);
+
+    auto still = reg.create();
+    reg.emplace<Transform2D>(still, 5.f, 6.f);
+    reg.emplace<Sprite>(still, interner.intern("pickups"), 0, 0, 8, 8, 1);
+
+    systems::BulletSpawnParams params;
+    params.origin_x = 100.f;
+    params.origin_y = 50.f;
+    params.speed = 120.f;
+    reg.ctx().get<SimTick>().tick = 9;
+    systems::spawn_bullet(reg, params);
+    reg.ctx().get<SimTick>().tick = 10;
+
+    std::vector<SpriteDraw> sprites;
+    systems::extract_sprites(reg, SpriteSheetManager{}, sprites);
+    REQUIRE(sprites.size() == 3);
+
+    // No sheets are loaded: every item is a placeholder, ordered by layer
+    REQUIRE(sprites[0].layer == 1);
+    REQUIRE(sprites[1].layer == 5);
+    REQUIRE(sprites[2].layer == 10);
+    REQUIRE(sprites[2].sheet == nullptr);
+    REQUIRE(sprites[2].placeholder.b == 255);
+
+    REQUIRE(sprites[0].prev_x == sprites[0].x);
+    REQUIRE(sprites[0].prev_y == sprites[0].y);
+
+    // Pooled bullet spawned in tick 9: one step in at the start of tick 10, two at the end
+    REQUIRE(sprites[1].prev_x == Approx(101.f));
+    REQUIRE(sprites[1].x == Approx(102.f));
+    REQUIRE(sprites[1].y == Approx(50.f));
+
+    REQUIRE(sprites[2].prev_x == 10.f);
+    REQUIRE(sprites[2].prev_y == 25.f);
+    REQUIRE(sprites[2].x == 20.f);
+    REQUIRE(sprites[2].y == 30.f);
+}
+
+TEST_CASE("extract_hud builds the HUD without a renderer", "[render_snapshot]") {
+    entt::registry reg;
+    auto player = reg.create();
+    reg.emplace<Player>(player);
+    reg.emplace<Health>(player, 2.f, 4.f);
+    auto& state = reg.ctx().emplace<GameState>();
+    state.score = 1200;
+    state.total_waves = 3;
+
+    std::vector<HudDraw> hud;
+    systems::extract_hud(reg, BitmapFont{}, hud);
+
+    // Health background + half fill, lives pips, score text, three wave dots
+    REQUIRE(hud[0].kind == HudDraw::Kind::Fill);
+    REQUIRE(hud[1].rect.w == Approx(20.f));
+    auto text = std::find_if(hud.begin(), hud.end(),
+                             [](const HudDraw& d) { return d.kind == HudDraw::Kind::Text; });
+    REQUIRE(text != hud.end());
+    REQUIRE(text->text == "1200");
+    REQUIRE(std::count_if(hud.begin(), hud.end(), [](const HudDraw& d) {
+                return d.kind == HudDraw::Kind::Outline;
+            }) == 2);
+
+    // Rebuilding replaces the previous tick's items
+    std::size_t count = hud.size();
+    systems::extract_hud(reg, BitmapFont{}, hud);
+    REQUIRE(hud.size() == count);
+}
+
+TEST_CASE("update_hud versions the HUD only when it changes", "[render_snapshot]") {
+    entt::registry reg;
+    auto player = reg.create();
+    reg.emplace<Player>(player);
+    reg.emplace<Health>(player, 4.f, 4.f);
+    auto& state = reg.ctx().emplace<GameState>();
+
+    systems::RetainedHud hud;
+    REQUIRE(systems::update_hud(reg, BitmapFont{}, hud));
+    REQUIRE(hud.version == 1);
+    REQUIRE_FALSE(systems::update_hud(reg, BitmapFont{}, hud));
+    REQUIRE(hud.version == 1);
+
+    state.score = 50;
+    REQUIRE(systems::update_hud(reg, BitmapFont{}, hud));
+    REQUIRE(hud.version == 2);
+
+    reg.get<Health>(player).current = 2.f;
+    REQUIRE(systems::update_hud(reg, BitmapFont{}, hud));
+    REQUIRE_FALSE(systems::update_hud(reg, BitmapFont{}, hud));
+    REQUIRE(hud.version == 3);
+
+    // Without a renderer the layer falls back to queueing the items
+    HudLayer layer(480, 270);
+    RenderQueue queue;
+    layer.draw(nullptr, queue, BitmapFont{}, hud.items, hud.version);
+    REQUIRE(queue.size() > 0);
+    REQUIRE(layer.redraws() == 0);
+    queue.flush(nullptr);
+}
+
+TEST_CASE("SpriteOrder keeps the draw order coherent across extracts", "[render_snapshot]") {
+    entt::registry reg;
+    auto& interner = reg.ctx().emplace<StringInterner>();
+    reg.ctx().emplace<SimTick>();
+
+    auto spawn = [&](float x, float y, int layer) {
+        auto entity = reg.create();
+        reg.emplace<Transform2D>(entity, x, y);
+        reg.emplace<Sprite>(entity, interner.intern("enemy"), 0, 0, 8, 8, layer);
+        return entity;
+    };
+    auto order = [&] {
+        std::vector<SpriteDraw> sprites;
+        systems::extract_sprites(reg, SpriteSheetManager{}, sprites);
+        std::vector<float> xs;
+        for (const auto& item : sprites) {
+            xs.push_back(item.x);
+        }
+        return xs;
+    };
+
+    // Sprites that exist before enabling are picked up too
+    spawn(20.f, 0.f, 1);
+    systems::enable_sprite_order(reg);
+
+    // Equal layer, sheet and y: only creation order separates these three
+    auto first = spawn(0.f, 40.f, 3);
+    auto middle = spawn(1.f, 40.f, 3);
+    spawn(2.f, 40.f, 3);
+    auto deep = spawn(10.f, 90.f, 3);
+
+    REQUIRE(order() == std::vector<float>{20.f, 0.f, 1.f, 2.f, 10.f});
+    REQUIRE(order() == std::vector<float>{20.f, 0.f, 1.f, 2.f, 10.f});
+
+    // Depth follows y within a layer
+    reg.get<Transform2D>(deep).y = 10.f;
+    REQUIRE(order() == std::vector<float>{20.f, 10.f, 0.f, 1.f, 2.f});
+
+    // Destroyed sprites drop out; new ones follow their equals
+    reg.destroy(middle);
+    spawn(30.f, 40.f, 3);
+    REQUIRE(order() == std::vector<float>{20.f, 10.f, 0.f, 2.f, 30.f});
+
+    // A sprite replaced between extracts is not listed twice
+    reg.remove<Sprite>(first);
+    reg.emplace<Sprite>(first, interner.intern("enemy"), 0, 0, 8, 8, 3);
+    REQUIRE(order().size() == 5);
+
+    systems::disable_sprite_order(reg);
+    REQUIRE_FALSE(reg.ctx().contains<systems::SpriteOrder>());
+    REQUIRE(order().size() == 5);
+}
@@ -274,6 +274,25 @@ TEST_CASE("Aim direction resolution", "[shooting]") {
         REQUIRE(aim.y == Catch::Approx(-1.f).margin(0.01f));
     }
 
+    SECTION("mouse aim is offset by the camera view") {
+        // Player in the world right of the first screen; the view scrolled with it
+        auto player = make_player(reg, 700.f, 400.f);
+        auto& camera = reg.ctx().emplace<Camera>();
+        camera.x = 500.f;
+        camera.y = 300.f;
+
+        InputState input{};
+        input.mouse_active = true;
+        input.mouse_x = 200.f; // World (700, 300): straight above the player
+        input.mouse_y = 0.f;
+
+        systems::update_shooting(reg, input, dt);
+
+        auto& aim = reg.get<AimDirection>(player);
+        REQUIRE(aim.x == Catch::Approx(0.f).margin(0.01f));
+        REQUIRE(aim.y == Catch::Approx(-1.f).margin(0.01f));
+    }
+
     SECTION("shoot fires bullet toward mouse") {
         auto player = make_player(reg, 100.f, 100.f);
 
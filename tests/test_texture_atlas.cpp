@@ -0,0 +1,65 @@
+#include "rendering/texture_atlas.hpp"
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <vector>
+
+using namespace raven;
+
+namespace {
+
+bool overlaps(const SDL_Rect& a, const SDL_Rect& b) {
+    return a.x < b.x + b.w && b.x < a.x + a.w && a.y < b.y + b.h && b.y < a.y + a.h;
+}
+
+} // namespace
+
+TEST_CASE("SkylinePacker places rects inside the page without overlap", "[atlas]") {
+    SkylinePacker packer(64, 64);
+    std::vector<SDL_Rect> placed;
+
+    // Mixed sizes, roughly the shape of a few sprite sheets and a font
+    const int sizes[][2] = {{32, 16}, {16, 16}, {16, 32}, {8, 8}, {24, 8}, {8, 24}, {40, 8}};
+    for (const auto& s : sizes) {
+        auto r = packer.insert(s[0], s[1]);
+        REQUIRE(r);
+        REQUIRE(r->w == s[0]);
+        REQUIRE(r->h == s[1]);
+        REQUIRE(r->x >= 0);
+        REQUIRE(r->y >= 0);
+        REQUIRE(r->x + r->w <= 64);
+        REQUIRE(r->y + r->h <= 64);
+        for (const auto& other : placed) {
+            REQUIRE_FALSE(overlaps(*r, other));
+        }
+        placed.push_back(*r);
+    }
+}
+
+TEST_CASE("SkylinePacker fills a page exactly with equal tiles", "[atlas]") {
+    SkylinePacker packer(32, 32);
+    for (int i = 0; i < 16; ++i) {
+        REQUIRE(packer.insert(8, 8));
+    }
+    REQUIRE_FALSE(packer.insert(8, 8));
+    REQUIRE_FALSE(packer.insert(1, 1));
+}
+
+TEST_CASE("SkylinePacker rejects rects that cannot fit", "[atlas]") {
+    SkylinePacker packer(16, 16);
+
+    SECTION("Larger than the page") {
+        REQUIRE_FALSE(packer.insert(17, 4));
+        REQUIRE_FALSE(packer.insert(4, 17));
+    }
+
+    SECTION("Empty rects") {
+        REQUIRE_FALSE(packer.insert(0, 4));
+    }
+
+    SECTION("Space runs out after the page is filled") {
+        REQUIRE(packer.insert(16, 12));
+        REQUIRE_FALSE(packer.insert(4, 8));
+        REQUIRE(packer.insert(16, 4));
+    }
+}
@@ -4,6 +4,11 @@
 
 #include <entt/entt.hpp>
 
+#include <cstdio>
+#include <fstream>
+#include <iterator>
+#include <vector>
+
 #include <catch2/catch_approx.hpp>
 #include <catch2/catch_test_macros.hpp>
 
@@ -96,6 +101,8 @@ TEST_CASE("Tilemap properties", "[tilemap]") {
     REQUIRE(tm.cell_size() == 16);
     REQUIRE(tm.is_loaded());
     REQUIRE(tm.texture() == nullptr); // no SDL texture in test
+    REQUIRE(tm.room_texture() == nullptr);
+    REQUIRE_FALSE(tm.bake(nullptr)); // nothing to bake without a tileset
 }
 
 TEST_CASE("Tile collision resolution", "[tilemap][ecs]") {
@@ -154,3 +161,161 @@ TEST_CASE("Tile collision resolution", "[tilemap][ecs]") {
         REQUIRE(vel.dx == Catch::Approx(50.f));
     }
 }
+
+TEST_CASE("Tilemap baked level cache", "[tilemap]") {
+    const std::string ldtk_path = "test_bake_tmp.ldtk";
+    const std::string rlvl_path = "test_bake_tmp.rlvl";
+    {
+        std::ofstream f(ldtk_path);
+        f << "{\"levels\": []}";
+    }
+    auto baked = make_bordered_tilemap();
+    baked.init_tiles({TileData{{16, 0, 16, 16}, 16, 16, true, false},
+                      TileData{{32, 16, 16, 16}, 32, 16, false, true}});
+    SpawnPoint exit{"Exit", 24.f, 40.f, {}};
+    exit.fields.emplace("target_level", std::string{"Room_1"});
+    exit.fields.emplace("waves", 3);
+    exit.fields.emplace("delay", 1.5f);
+    exit.fields.emplace("locked", true);
+    exit.fields.emplace("landing", SDL_FPoint{40.f, 56.f});
+    baked.init_spawns({exit});
+    REQUIRE(baked.save_baked(rlvl_path, ldtk_path));
+
+    SECTION("Round trip restores the level") {
+        Tilemap tm;
+        REQUIRE(tm.load_baked(rlvl_path, ldtk_path));
+        REQUIRE(tm.is_loaded());
+        REQUIRE(tm.width_px() == 64);
+        REQUIRE(tm.height_px() == 64);
+        REQUIRE(tm.cell_size() == 16);
+        for (int y = 0; y < 4; ++y) {
+            for (int x = 0; x < 4; ++x) {
+                REQUIRE(tm.is_cell_solid(x, y) == baked.is_cell_solid(x, y));
+            }
+        }
+        REQUIRE(tm.tiles().size() == 2);
+        for (size_t i = 0; i < 2; ++i) {
+            const auto& a = tm.tiles()[i];
+            const auto& b = baked.tiles()[i];
+            REQUIRE(a.src.x == b.src.x);
+            REQUIRE(a.src.y == b.src.y);
+            REQUIRE(a.dest_x == b.dest_x);
+            REQUIRE(a.dest_y == b.dest_y);
+            REQUIRE(a.flip_x == b.flip_x);
+            REQUIRE(a.flip_y == b.flip_y);
+        }
+    }
+
+    SECTION("Spawn fields keep their types") {
+        Tilemap tm;
+        REQUIRE(tm.load_baked(rlvl_path, ldtk_path));
+        const auto* sp = tm.find_spawn("Exit");
+        REQUIRE(sp != nullptr);
+        REQUIRE(sp->x == Catch::Approx(24.f));
+        REQUIRE(sp->fields.size() == 5);
+        REQUIRE(*sp->field<std::string>("target_level") == "Room_1");
+        REQUIRE(*sp->field<int>("waves") == 3);
+        REQUIRE(*sp->field<float>("delay") == Catch::Approx(1.5f));
+        REQUIRE(*sp->field<bool>("locked"));
+        REQUIRE(sp->field<SDL_FPoint>("landing")->y == Catch::Approx(56.f));
+        REQUIRE(sp->field<std::string>("waves") == nullptr);
+        REQUIRE(sp->field<int>("missing") == nullptr);
+    }
+
+    SECTION("Edited source invalidates the blob") {
+        {
+            std::ofstream f(ldtk_path);
+            f << "{\"levels\": [{}]}";
+        }
+        Tilemap tm;
+        REQUIRE_FALSE(tm.load_baked(rlvl_path, ldtk_path));
+        REQUIRE_FALSE(tm.is_loaded());
+    }
+
+    SECTION("Missing or corrupt blob is rejected") {
+        Tilemap tm;
+        REQUIRE_FALSE(tm.load_baked("nonexistent_dir/level.rlvl", ldtk_path));
+        {
+            std::ofstream f(rlvl_path, std::ios::binary);
+            f << "RLVL";
+        }
+        REQUIRE_FALSE(tm.load_baked(rlvl_path, ldtk_path));
+    }
+
+    SECTION("Unknown tile flag bits are rejected") {
+        std::vector<char> blob;
+        {
+            std::ifstream f(rlvl_path, std::ios::binary);
+            blob.assign(std::istreambuf_iterator<char>(f), {});
+        }
+        // Header (32) + level dims (20) + empty tileset path (4) + tile count (4),
+        // then the first tile's six i32 fields
+        constexpr size_t first_flags = 32 + 20 + 4 + 4 + 24;
+        REQUIRE(blob.size() > first_flags);
+        REQUIRE(blob[first_flags] == 1);
+        blob[first_flags] = 5;
+        {
+            std::ofstream f(rlvl_path, std::ios::binary);
+            f.write(blob.data(), static_cast<std::streamsize>(blob.size()));
+        }
+        Tilemap tm;
+        REQUIRE_FALSE(tm.load_baked(rlvl_path, ldtk_path));
+    }
+
+    SECTION("Baked path sits next to the project") {
+        REQUIRE(baked_level_path("assets/maps/raven.ldtk", "Room_0") ==
+                "assets/maps/baked/Room_0.rlvl");
+    }
+
+    std::remove(rlvl_path.c_str());
+    std::remove(ldtk_path.c_str());
+}
+
+TEST_CASE("Tilemap chunks", "[tilemap]") {
+    // 40x20 cells of 16 px: 3x2 chunks of 16 cells, the last column and row partial
+    Tilemap tm;
+    tm.init_collision(40, 20, 16, std::vector<bool>(40 * 20, false));
+
+    std::vector<TileData> tiles;
+    auto tile_at = [](int cell_x, int cell_y, int src_x) {
+        return TileData{{src_x, 0, 16, 16}, cell_x * 16, cell_y * 16, false, false};
+    };
+    tiles.push_back(tile_at(39, 19, 0)); // chunk (2, 1)
+    tiles.push_back(tile_at(0, 0, 0));   // chunk (0, 0), back layer
+    tiles.push_back(tile_at(17, 3, 0));  // chunk (1, 0)
+    tiles.push_back(tile_at(0, 0, 16));  // chunk (0, 0), front layer
+    tm.init_tiles(std::move(tiles));
+
+    REQUIRE(tm.chunk_size_px() == 256);
+    REQUIRE(tm.tiles().size() == 4);
+
+    SECTION("Tiles are grouped by chunk in draw order") {
+        auto origin = tm.chunk_tiles(0, 0);
+        REQUIRE(origin.size() == 2);
+        REQUIRE(origin[0].src.x == 0);
+        REQUIRE(origin[1].src.x == 16);
+        REQUIRE(tm.chunk_tiles(1, 0).size() == 1);
+        REQUIRE(tm.chunk_tiles(2, 1).size() == 1);
+        REQUIRE(tm.chunk_tiles(1, 1).empty());
+        REQUIRE(tm.chunk_tiles(3, 0).empty());
+        REQUIRE(tm.chunk_tiles(-1, 0).empty());
+    }
+
+    SECTION("chunks_in covers the view and clips to the level") {
+        SDL_Rect view = tm.chunks_in({0.f, 0.f, 200.f, 100.f});
+        REQUIRE(view.x == 0);
+        REQUIRE(view.y == 0);
+        REQUIRE(view.w == 1);
+        REQUIRE(view.h == 1);
+
+        SDL_Rect grown = tm.chunks_in({300.f, 10.f, 100.f, 100.f}, 1);
+        REQUIRE(grown.x == 0);
+        REQUIRE(grown.y == 0);
+        REQUIRE(grown.w == 3);
+        REQUIRE(grown.h == 2);
+
+        SDL_Rect outside = tm.chunks_in({2000.f, 2000.f, 100.f, 100.f});
+        REQUIRE(outside.w == 0);
+        REQUIRE(outside.h == 0);
+    }
+}
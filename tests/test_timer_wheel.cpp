@@ -0,0 +1,119 @@
+#include "core/timer_wheel.hpp"
+#include "ecs/command_buffer.hpp"
+#include "ecs/components.hpp"
+#include "ecs/expiry_timers.hpp"
+
+#include <entt/entt.hpp>
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <cstdint>
+#include <vector>
+
+using namespace raven;
+
+TEST_CASE("TimerWheel fires each timer on its deadline tick", "[timer_wheel]") {
+    TimerWheel<int> wheel;
+    wheel.reset(10);
+
+    // Deadlines spanning level 0 through level 3
+    const std::vector<uint64_t> deadlines{11, 12, 265, 266, 300, 70'000, 16'777'300};
+    for (std::size_t i = 0; i < deadlines.size(); ++i) {
+        wheel.schedule(deadlines[i], static_cast<int>(i));
+    }
+    REQUIRE(wheel.size() == deadlines.size());
+
+    std::vector<uint64_t> fired_at(deadlines.size(), 0);
+    int fired = 0;
+    auto record = [&](const TimerWheel<int>::Entry& entry) {
+        REQUIRE(entry.deadline == wheel.now());
+        fired_at[static_cast<std::size_t>(entry.payload)] = wheel.now();
+        ++fired;
+    };
+
+    wheel.advance(299, record);
+    REQUIRE(fired == 4);
+    wheel.advance(16'777'300, record);
+    REQUIRE(fired == 7);
+    REQUIRE(fired_at == deadlines);
+    REQUIRE(wheel.size() == 0);
+}
+
+TEST_CASE("TimerWheel clamps past deadlines and allows rescheduling", "[timer_wheel]") {
+    TimerWheel<int> wheel;
+    wheel.reset(100);
+    wheel.schedule(50, 1);
+
+    int fired = 0;
+    wheel.advance(101, [&](const TimerWheel<int>::Entry& entry) {
+        ++fired;
+        if (entry.payload == 1) {
+            wheel.schedule(wheel.now() + 1, 2);
+        }
+    });
+    REQUIRE(fired == 1);
+    REQUIRE(wheel.size() == 1);
+
+    wheel.advance(102, [&](const TimerWheel<int>::Entry& entry) {
+        REQUIRE(entry.payload == 2);
+        ++fired;
+    });
+    REQUIRE(fired == 2);
+}
+
+TEST_CASE("ExpiryTimers expire Lifetime after the same tick count", "[timer_wheel][ecs]") {
+    entt::registry reg;
+    enable_expiry_timers(reg, 0);
+    auto& timers = reg.ctx().get<ExpiryTimers>();
+
+    auto short_lived = reg.create();
+    reg.emplace<Lifetime>(short_lived, 0.5f);
+    auto long_lived = reg.create();
+    reg.emplace<Lifetime>(long_lived, 5.f);
+    REQUIRE(reg.get<Lifetime>(short_lived).expires_tick == 60);
+
+    CommandBuffer cmds;
+    for (int i = 0; i < 59; ++i) {
+        advance_expiry_timers(reg, timers, cmds);
+        cmds.flush(reg);
+    }
+    REQUIRE(reg.valid(short_lived));
+
+    advance_expiry_timers(reg, timers, cmds);
+    cmds.flush(reg);
+    REQUIRE_FALSE(reg.valid(short_lived));
+    REQUIRE(reg.valid(long_lived));
+
+    disable_expiry_timers(reg);
+    REQUIRE_FALSE(reg.ctx().contains<ExpiryTimers>());
+}
+
+TEST_CASE("ExpiryTimers honour replaced and extended invulnerability", "[timer_wheel][ecs]") {
+    entt::registry reg;
+    enable_expiry_timers(reg, 1000);
+    auto& timers = reg.ctx().get<ExpiryTimers>();
+    auto player = reg.create();
+    CommandBuffer cmds;
+
+    SECTION("Replacing the component invalidates the old deadline") {
+        reg.emplace<Invulnerable>(player, 0.1f);
+        reg.emplace_or_replace<Invulnerable>(player, 1.f);
+        for (int i = 0; i < 119; ++i) {
+            advance_expiry_timers(reg, timers, cmds);
+        }
+        REQUIRE(reg.all_of<Invulnerable>(player));
+        advance_expiry_timers(reg, timers, cmds);
+        REQUIRE_FALSE(reg.all_of<Invulnerable>(player));
+    }
+
+    SECTION("extend_invulnerability never shortens i-frames") {
+        reg.emplace<Invulnerable>(player, 2.f);
+        auto deadline = reg.get<Invulnerable>(player).expires_tick;
+        extend_invulnerability(reg, player, 0.18f);
+        REQUIRE(reg.get<Invulnerable>(player).expires_tick == deadline);
+
+        reg.remove<Invulnerable>(player);
+        extend_invulnerability(reg, player, 0.18f);
+        REQUIRE(reg.get<Invulnerable>(player).expires_tick == timers.deadline(0.18f));
+    }
+}
@@ -0,0 +1,56 @@
+// raven_bake_levels — bake every level of an LDtk project into .rlvl blobs.
+//
+// Usage: raven_bake_levels [path/to/project.ldtk]
+//
+// Writes "<ldtk dir>/baked/<level>.rlvl" for each level (see baked_level_path()).
+// Tilemap::parse() picks these up at runtime and falls back to the .ldtk when
+// a blob is missing or stale, so re-running this after editing a map is an
+// optimisation, not a requirement.
+
+#include "rendering/tilemap.hpp"
+
+#include <SDL3/SDL.h>
+#include <spdlog/spdlog.h>
+
+#include <LDtkLoader/Project.hpp>
+
+#include <string>
+#include <vector>
+
+int main(int argc, char* argv[]) {
+    std::string ldtk_path = argc > 1 ? argv[1] : "assets/maps/raven.ldtk";
+
+    std::vector<std::string> levels;
+    try {
+        ldtk::Project project;
+        project.loadFromFile(ldtk_path);
+        for (const auto& level : project.getWorld().allLevels()) {
+            levels.push_back(level.name);
+        }
+    } catch (const std::exception& e) {
+        spdlog::error("Failed to load LDtk project '{}': {}", ldtk_path, e.what());
+        return 1;
+    }
+
+    std::string out_dir = raven::baked_level_path(ldtk_path, "");
+    out_dir.resize(out_dir.find_last_of('/') + 1);
+    if (!SDL_CreateDirectory(out_dir.c_str())) {
+        spdlog::error("Failed to create '{}': {}", out_dir, SDL_GetError());
+        return 1;
+    }
+
+    int failed = 0;
+    for (const auto& name : levels) {
+        raven::Tilemap tilemap;
+        std::string rlvl_path = raven::baked_level_path(ldtk_path, name);
+        if (!tilemap.parse_ldtk(ldtk_path, name) || !tilemap.save_baked(rlvl_path, ldtk_path)) {
+            ++failed;
+            continue;
+        }
+        spdlog::info("Baked '{}' -> {}", name, rlvl_path);
+    }
+
+    spdlog::info("Baked {}/{} levels", levels.size() - static_cast<size_t>(failed),
+                 levels.size());
+    return failed == 0 ? 0 : 1;
+}
@@ -0,0 +1,106 @@
+// raven_pack_assets — pack the assets directory into a single .rpak archive.
+//
+// Usage: raven_pack_assets [source dir] [output.rpak]
+//
+// Walks "<source dir>/assets" and stores every file under its path relative
+// to the source dir ("assets/sprites/player.png"). PNGs are decoded to RGBA32,
+// JSON is re-encoded as MessagePack, and everything else (WAVs, the LDtk
+// project, baked levels) is stored verbatim. Place the output next to the
+// executable as "raven.rpak"; see assets::mount().
+
+#include "core/asset_pack.hpp"
+
+#include <SDL3/SDL.h>
+#include <SDL3_image/SDL_image.h>
+#include <nlohmann/json.hpp>
+#include <spdlog/spdlog.h>
+
+#include <algorithm>
+#include <string>
+#include <string_view>
+
+namespace {
+
+bool ends_with(const std::string& s, const char* suffix) {
+    std::string_view sv{suffix};
+    return s.size() >= sv.size() && s.compare(s.size() - sv.size(), sv.size(), sv) == 0;
+}
+
+bool add_file(raven::AssetPackWriter& pack, const std::string& name, const std::string& path) {
+    if (ends_with(name, ".png")) {
+        SDL_Surface* surface = IMG_Load(path.c_str());
+        if (!surface) {
+            spdlog::error("Failed to decode '{}': {}", path, SDL_GetError());
+            return false;
+        }
+        bool ok = pack.add_pixels(name, surface);
+        SDL_DestroySurface(surface);
+        return ok;
+    }
+
+    size_t size = 0;
+    void* data = SDL_LoadFile(path.c_str(), &size);
+    if (!data) {
+        spdlog::error("Failed to read '{}': {}", path, SDL_GetError());
+        return false;
+    }
+    bool ok = true;
+    if (ends_with(name, ".json")) {
+        try {
+            const auto* bytes = static_cast<const char*>(data);
+            pack.add_json(name, nlohmann::json::parse(bytes, bytes + size));
+        } catch (const nlohmann::json::exception& e) {
+            spdlog::error("Failed to parse '{}': {}", path, e.what());
+            ok = false;
+        }
+    } else {
+        pack.add_raw(name, data, size);
+    }
+    SDL_free(data);
+    return ok;
+}
+
+} // namespace
+
+int main(int argc, char* argv[]) {
+    std::string source_dir = argc > 1 ? argv[1] : ".";
+    std::string out_path = argc > 2 ? argv[2] : "raven.rpak";
+    if (!source_dir.empty() && source_dir.back() != '/') {
+        source_dir += '/';
+    }
+
+    const std::string assets_dir = source_dir + "assets";
+    int count = 0;
+    char** files = SDL_GlobDirectory(assets_dir.c_str(), nullptr, 0, &count);
+    if (!files) {
+        spdlog::error("Failed to list '{}': {}", assets_dir, SDL_GetError());
+        return 1;
+    }
+
+    raven::AssetPackWriter pack;
+    int packed = 0;
+    int failed = 0;
+    for (int i = 0; i < count; ++i) {
+        std::string name = std::string{"assets/"} + files[i];
+        std::replace(name.begin(), name.end(), '\\', '/');
+        std::string path = source_dir + name;
+
+        SDL_PathInfo info;
+        if (!SDL_GetPathInfo(path.c_str(), &info) || info.type != SDL_PATHTYPE_FILE) {
+            continue;
+        }
+        if (add_file(pack, name, path)) {
+            ++packed;
+        } else {
+            ++failed;
+        }
+    }
+    SDL_free(files);
+
+    if (failed > 0 || !pack.write(out_path)) {
+        spdlog::error("Asset pack not written ({} files failed)", failed);
+        return 1;
+    }
+    spdlog::info("Packed {} files into '{}'", packed, out_path);
+    return 0;
+}